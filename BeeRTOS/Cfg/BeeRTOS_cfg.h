@@ -27,6 +27,16 @@
 #define BEERTOS_QUEUE_MODULE_EN (true)
 #define BEERTOS_MUTEX_MODULE_EN (true)
 #define BEERTOS_SEMAPHORE_MODULE_EN (true)
+#define BEERTOS_EVENT_MODULE_EN (true)
+#define BEERTOS_DEFER_MODULE_EN (true)
+#define BEERTOS_WDG_MODULE_EN (true)
+
+/* Highest interrupt priority (the value written to BASEPRI) from which the OS API can be called.
+ * Critical sections mask only the interrupts with this or lower priority, interrupts with a higher
+ * priority (numerically lower value) are never delayed by the kernel, but must not call the OS API.
+ * The value is shifted to the implemented priority bits, e.g. 0x50 is priority 5 with 4 bits.
+ * Set to 0 to mask all interrupts in critical sections (PRIMASK). */
+#define BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY (0x50U)
 
 /* Stack size of the idle task in bytes - if callbacks not used you can set 16 bytes */
 #define BEERTOS_IDLE_TASK_STACK_SIZE (64U)
@@ -50,12 +60,143 @@
 #define BEERTOS_USE_USER_STACK_MONITOR (false)
 #define OS_TASK_STACK_CHECK_BYTE_COUNT (10U)
 
+/* Cortex-M only - enable this option to detect stack overflows with the MPU instead of the
+ * stack monitor. The lowest 32 bytes of every task stack are a no-access MPU region, moved
+ * to the incoming task in PendSV_Handler, so an overflow faults immediately (MemManage) with
+ * no check on the context switch. The stack monitor must be disabled, BEERTOS_MPU_STACK_GUARD_REGION
+ * is the MPU region used for the guard (the highest region has the highest priority). */
+#define BEERTOS_USE_MPU_STACK_GUARD (false)
+#define BEERTOS_MPU_STACK_GUARD_REGION (7U)
+
+/* Enable this option to measure the stack high-water mark of all tasks (see
+ * os_task_get_stack_high_water). The unused stack is filled with the pattern and the idle
+ * task scans it from the stack base, BEERTOS_STACK_HIGH_WATER_SCAN_WORDS words per idle
+ * loop iteration, so the measurement never adds context switch latency. */
+#define BEERTOS_USE_STACK_HIGH_WATER (true)
+#define BEERTOS_STACK_HIGH_WATER_SCAN_WORDS (16U)
+
+/* Enable this option to time-slice tasks sharing a priority level (defined with BEERTOS_RR_TASK).
+ * The running task of a group is switched to the next ready member of the group after
+ * BEERTOS_ROUND_ROBIN_QUANTUM ticks. */
+#define BEERTOS_USE_ROUND_ROBIN (true)
+#define BEERTOS_ROUND_ROBIN_QUANTUM (10U)
+
+/* Enable this option to keep delayed tasks in a delta list ordered by wakeup time instead of
+ * decrementing the ticks of every delayed task on each tick. The tick then costs O(1) plus
+ * the number of tasks woken up, the delay insertion is O(n) and runs in the task context. */
+#define BEERTOS_USE_DELAY_LIST (false)
+
+/* Enable this option to use the tickless idle mode. When only the idle task is ready to run,
+ * the tick interrupt is suppressed until the earliest delayed task, alarm or watchdog check
+ * (BEERTOS_WDG_MODULE_EN) is due. After wakeup, the skipped ticks are credited to the tick
+ * counter in one step. */
+#define BEERTOS_USE_TICKLESS_IDLE (true)
+/* Minimum number of idle ticks for which the tick interrupt is suppressed, must be >= 2 */
+#define BEERTOS_TICKLESS_IDLE_MIN_TICKS (2U)
+
+/* Enable this option to use direct-to-task notifications. Each task gets a 32-bit notification
+ * value, which can be used as a lightweight binary/counting semaphore or event flags for the
+ * one-to-one wakeup pattern, without any configuration (see os_task_notify). */
+#define BEERTOS_USE_TASK_NOTIFICATIONS (true)
+
+/* Enable this option to measure the CPU time of every task. The time is accumulated on each
+ * context switch from the port timestamp (DWT cycle counter on Cortex-M4, nanoseconds on the
+ * POSIX host), see os_task_get_runtime and os_get_cpu_load. A task must not run longer than
+ * one period of the 32-bit timestamp without a context switch. */
+#define BEERTOS_USE_RUNTIME_STATS (true)
+
+/* Enable this option to measure the wakeup latency of every task - the time from the release
+ * of a blocked task until it runs, in port timestamp units. A task released by an interrupt
+ * is measured from the entry of the interrupt (see os_isr_enter), so for periodic tasks the
+ * spread of the latency is the jitter of their start. Each task keeps min/max and a histogram
+ * of BEERTOS_LATENCY_HISTOGRAM_BUCKETS log2 buckets, the first bucket counts the latencies
+ * below 2^BEERTOS_LATENCY_HISTOGRAM_SHIFT, the last one all the latencies above its start. */
+#define BEERTOS_USE_LATENCY_STATS (true)
+#define BEERTOS_LATENCY_HISTOGRAM_BUCKETS (16U)
+#define BEERTOS_LATENCY_HISTOGRAM_SHIFT (6U)
+
+/* Enable this option to use the native trace recorder instead of SEGGER SystemView (see
+ * BeeRTOS_trace_cfg.h). Kernel events are written as 12-byte records into a RAM ring buffer of
+ * BEERTOS_TRACE_BUFFER_SIZE records (a power of 2), the oldest records are overwritten.
+ * BEERTOS_TRACE_TIMESTAMP_HZ is the frequency of the port timestamp stored for the decoder
+ * (the core clock on Cortex-M4, 1000000000 on the POSIX host), 0 if unknown. Task names are
+ * truncated to BEERTOS_TRACE_NAME_LENGTH - 1 characters. */
+#define BEERTOS_USE_TRACE_RECORDER (true)
+#define BEERTOS_TRACE_BUFFER_SIZE (256U)
+#define BEERTOS_TRACE_TIMESTAMP_HZ (0U)
+#define BEERTOS_TRACE_NAME_LENGTH (16U)
+
+/* RAM budget of the kernel in bytes - the build fails (BeeRTOS_footprint.c) when the kernel
+ * objects of this configuration (stacks, TCBs, queue and message buffers, object tables, trace
+ * buffer) need more RAM, see BeeRTOS_footprint.h and Tools/footprint_report.py. 0 disables the check. */
+#define BEERTOS_RAM_BUDGET (0U)
+
+/* Enable this option to create tasks at runtime (see os_task_create_dynamic). A dynamic task
+ * runs at the priority level of a BEERTOS_POOL_TASK entry and takes a task control block and
+ * a stack from a pool slot of the requested stack class (BEERTOS_TASK_POOL_LIST), os_task_delete
+ * returns the slot. There can be more pool priority levels than slots. */
+#define BEERTOS_USE_TASK_POOL (true)
+
+/* Enable this option to use basic tasks (BEERTOS_BASIC_TASK) - run-to-completion tasks in the
+ * spirit of OSEK basic tasks. A basic task has no stack of its own, when it is dispatched it
+ * takes its stack size from the shared stack of BEERTOS_BASIC_TASK_STACK_SIZE words, below the
+ * basic tasks it preempted, and gives it back when its function returns. Basic tasks must never
+ * block. Size the shared stack to the deepest chain of basic tasks preempting each other (the sum
+ * of their stack sizes), the deepest chain reached is returned by os_task_get_basic_stack_peak. */
+#define BEERTOS_USE_BASIC_TASKS (true)
+#define BEERTOS_BASIC_TASK_STACK_SIZE (192U)
+
+/* Enable this option to use preemption thresholds (BEERTOS_THRESHOLD_TASK), in the style of
+ * ThreadX. While such a task runs, it is preempted only by the tasks above its threshold, the
+ * tasks between its priority and the threshold wait until it blocks. Tasks sharing data only
+ * with tasks within their threshold need no mutex and cause fewer context switches. */
+#define BEERTOS_USE_PREEMPTION_THRESHOLD (true)
+
+/* Enable this option to schedule the tasks defined with BEERTOS_EDF_TASK by the earliest
+ * deadline first policy. Each of them declares a relative deadline, the absolute deadline is
+ * set when the task becomes ready. The EDF tasks form one group of consecutive priority levels,
+ * when the group is the highest ready level, its ready task with the earliest absolute deadline
+ * runs (kept in a heap, O(log n) per ready state change). All other tasks keep the fixed
+ * priority scheduling. */
+#define BEERTOS_USE_EDF (true)
+
+/* Enable this option to use periodic tasks (BEERTOS_PERIODIC_TASK). The kernel releases the job
+ * function of such a task at the absolute ticks offset + n * period and measures the response
+ * time of each job (see os_task_get_periodic_stats). A job which completes at or after its
+ * deadline is counted as a miss and reported by BEERTOS_DEADLINE_MISS_CB, called from the
+ * periodic task after the job (task_id - id of the task, response_time - in ticks). */
+#define BEERTOS_USE_PERIODIC_TASKS (true)
+#define BEERTOS_DEADLINE_MISS_CB(task_id, response_time) \
+    do                                                   \
+    {                                                    \
+    } while (0)
+
+/* Task liveness watchdog (BEERTOS_WDG_MODULE_EN) - a task registered with os_wdg_register must call
+ * os_wdg_kick at least once per its check-in period. The tick checks the deadlines in O(1), when a task
+ * misses its check-in, BEERTOS_WDG_MISS_CB(task_id) is called from the tick interrupt (only the FromISR
+ * API can be used there). BEERTOS_WDG_FEED is called on every tick while no registered task missed its
+ * check-in - feed the hardware watchdog there, so it resets the system unless the task checks in again,
+ * is unregistered or the application recovers it. */
+#define BEERTOS_WDG_MISS_CB(task_id) \
+    do                               \
+    {                                \
+    } while (0)
+#define BEERTOS_WDG_FEED() \
+    do                     \
+    {                      \
+    } while (0)
+
+/* Number of entries of the deferred interrupt work ring (see os_defer_from_isr), must be
+ * a power of 2. Work posted while the ring is full is rejected. */
+#define BEERTOS_DEFER_QUEUE_SIZE (8U)
+
 /*!
  *  @brief OS tasks configuration list - define your tasks here.
  *  In the current implementation, all tasks are created statically.
  *  The priority of the tasks is defined by their order in this list -
- *  the first task has the highest priority. Up to 64 tasks can be created,
- *  but one is reserved for the idle task.
+ *  the first task has the highest priority. Up to 1024 tasks can be created,
+ *  but one is reserved for the idle task. Above 32 tasks a two-level
+ *  priority bitmap is used (see BeeRTOS_bitmap.h).
  *
  *  Structure for defining a task: BEERTOS_TASK(task_id, function, stacksize, autostart, task_arg)
  *  @param task_id - Unique task identifier, created in the os_task_id_t enum.
@@ -70,6 +211,16 @@
  *          uint32_t my_arg = (uint32_t)arg; // Casting argument to the expected type
  *      }
  *
+ *  @brief BeeRTOS round-robin tasks - tasks sharing a priority level.
+ *  Consecutive BEERTOS_RR_TASK entries with the same group number form a priority group.
+ *  The group is scheduled as a single priority level, the tasks within the group are
+ *  time-sliced (BEERTOS_USE_ROUND_ROBIN must be enabled, otherwise the tasks get
+ *  separate priorities according to their order in the list).
+ *
+ *  Structure for defining a task: BEERTOS_RR_TASK(task_id, function, stacksize, autostart, task_arg, group)
+ *  @param task_id, function, stacksize, autostart, task_arg - same as for BEERTOS_TASK
+ *  @param group - number identifying the group, shared by all consecutive tasks of the group
+ *
  *  @brief BeeRTOS mutex list - define your mutexes here.
  *  Mutexes are used to protect critical sections from concurrent access by multiple tasks.
  *  They are recursive, allowing the same task to lock the mutex multiple times, requiring
@@ -86,15 +237,99 @@
  *  Structure for defining the alarm task: BEERTOS_ALARM_TASK(task_id, stacksize)
  *  @param task_id - Task identifier for the alarm task, created in the os_task_id_t enum.
  *  @param stacksize - The stack size for the alarm task in bytes.
+ *
+ *  @brief BeeRTOS defer task configuration - define the deferred interrupt work task here.
+ *  There can only be one defer task defined in the system, it must be named OS_DEFER_TASK
+ *  (only with BEERTOS_DEFER_MODULE_EN enabled).
+ *  The task runs the callbacks posted by interrupts with os_defer_from_isr, its position
+ *  in the list defines the priority of the deferred work.
+ *
+ *  Structure for defining the defer task: BEERTOS_DEFER_TASK(task_id, stacksize)
+ *  @param task_id - Task identifier for the defer task, created in the os_task_id_t enum.
+ *  @param stacksize - The stack size for the defer task in bytes.
+ *
+ *  @brief BeeRTOS pool tasks - priority levels of tasks created at runtime.
+ *  The entry reserves the priority level only, the task control block and the stack are
+ *  taken from the task pool by os_task_create_dynamic (BEERTOS_USE_TASK_POOL must be enabled).
+ *
+ *  Structure for defining a pool task: BEERTOS_POOL_TASK(task_id)
+ *  @param task_id - Task identifier passed to os_task_create_dynamic, created in the os_task_id_t enum.
+ *
+ *  @brief BeeRTOS basic tasks - run-to-completion tasks sharing one stack.
+ *  A basic task is activated by os_task_start and runs until its function returns, then it can
+ *  be activated again (activations are not queued). It must not call blocking functions (delays,
+ *  waits with a timeout, os_task_delete), BEERTOS_USE_BASIC_TASKS must be enabled.
+ *
+ *  Structure for defining a basic task: BEERTOS_BASIC_TASK(task_id, function, stacksize, autostart, task_arg)
+ *  @param task_id, function, autostart, task_arg - same as for BEERTOS_TASK
+ *  @param stacksize - The part of the shared stack used by the task, including the context saved when it is preempted.
+ *
+ *  @brief BeeRTOS threshold tasks - tasks with a preemption threshold.
+ *  While the task runs, only the tasks above the threshold task can preempt it. The threshold
+ *  must not be below the task itself (BEERTOS_USE_PREEMPTION_THRESHOLD must be enabled, otherwise
+ *  the threshold is ignored and the task is scheduled as a BEERTOS_TASK).
+ *
+ *  Structure for defining a task: BEERTOS_THRESHOLD_TASK(task_id, function, stacksize, autostart, task_arg, threshold)
+ *  @param task_id, function, stacksize, autostart, task_arg - same as for BEERTOS_TASK
+ *  @param threshold - id of the highest priority task which must not preempt the task
+ *
+ *  @brief BeeRTOS EDF tasks - tasks scheduled by their deadlines.
+ *  All BEERTOS_EDF_TASK entries must follow each other, they form a group scheduled as a single
+ *  priority level by the earliest deadline first policy (BEERTOS_USE_EDF must be enabled,
+ *  otherwise the deadline is ignored and the tasks get priorities by their order in the list).
+ *
+ *  Structure for defining a task: BEERTOS_EDF_TASK(task_id, function, stacksize, autostart, task_arg, deadline)
+ *  @param task_id, function, stacksize, autostart, task_arg - same as for BEERTOS_TASK
+ *  @param deadline - relative deadline in ticks, counted from the moment the task becomes ready
+ *
+ *  @brief BeeRTOS periodic tasks - jobs released by the kernel at fixed ticks.
+ *  The kernel calls the job function once per period, the function returns after each job
+ *  (BEERTOS_USE_PERIODIC_TASKS must be enabled). Periodic tasks are always started.
+ *
+ *  Structure for defining a task: BEERTOS_PERIODIC_TASK(task_id, function, stacksize, period, offset, deadline)
+ *  @param task_id, stacksize - same as for BEERTOS_TASK
+ *  @param function - The job function, void function(void).
+ *  @param period - ticks between the releases of the jobs
+ *  @param offset - tick of the first release
+ *  @param deadline - relative deadline of each job in ticks, counted from its release
  */
+/* Entries of the optional features used by the smoke tests, empty if the feature is disabled */
+#if (BEERTOS_DEFER_MODULE_EN == true)
+#define UT_DEFER_TASKS() \
+    BEERTOS_DEFER_TASK(OS_DEFER_TASK, 128)
+#else
+#define UT_DEFER_TASKS()
+#endif
+
+#if (BEERTOS_USE_TASK_POOL == true)
+#define UT_POOL_TASKS()                \
+    BEERTOS_POOL_TASK(OS_TASK_POOL_1)  \
+    BEERTOS_POOL_TASK(OS_TASK_POOL_2)  \
+    BEERTOS_POOL_TASK(OS_TASK_POOL_3)
+#else
+#define UT_POOL_TASKS()
+#endif
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+#define UT_BASIC_TASKS()                                                     \
+    BEERTOS_BASIC_TASK(OS_TASK_BASIC_2, ut_basic_task, 96, false, (void *)2) \
+    BEERTOS_BASIC_TASK(OS_TASK_BASIC_1, ut_basic_task, 96, false, (void *)1)
+#else
+#define UT_BASIC_TASKS()
+#endif
+
 /*! @brief BeeRTOS priority list - define tasks, mutexes, and alarm task here
  *
  *  This configuration defines system tasks, mutexes, and a single alarm task as per
  *  the new capabilities of the BeeRTOS system.
  */
 #define BEERTOS_PRIORITY_LIST()                                                 \
+    /* Benchmark partner task */                                                \
+    BEERTOS_TASK(OS_TASK_BM, bm_task_partner, 128, false, NULL)                 \
+    BEERTOS_MUTEX(MUTEX_BM, 0U)                                                 \
     BEERTOS_TASK(OS_TASK_UT_MAIN, ut_beertos_main_task, 128, true, NULL)        \
     BEERTOS_ALARM_TASK(OS_ALARM_TASK, 128)                                      \
+    UT_DEFER_TASKS()                                                            \
     /* Priority test tasks */                                                   \
     BEERTOS_TASK(OS_TASK_PRIO_3, ut_task_priority_highest, 128, true, NULL)     \
     BEERTOS_TASK(OS_TASK_PRIO_2, ut_task_priority_medium, 128, true, NULL)      \
@@ -106,7 +341,37 @@
     BEERTOS_TASK(OS_TASK_MUTEX_1, mutex_low_priority_task, 128, false, NULL)    \
     /* Message test tasks */                                                    \
     BEERTOS_TASK(OS_TASK_MSG_2, ut_task_msg_2, 128, false, NULL)                \
-    BEERTOS_TASK(OS_TASK_MSG_1, ut_task_msg_1, 128, false, NULL)
+    BEERTOS_TASK(OS_TASK_MSG_1, ut_task_msg_1, 128, false, NULL)                \
+    /* Round-robin test tasks */                                                \
+    BEERTOS_RR_TASK(OS_TASK_RR_1, ut_task_rr, 128, false, (void *)0, 1U)        \
+    BEERTOS_RR_TASK(OS_TASK_RR_2, ut_task_rr, 128, false, (void *)1, 1U)        \
+    /* Task notification test tasks */                                          \
+    BEERTOS_TASK(OS_TASK_NOTIFY, ut_task_notify, 128, false, NULL)              \
+    /* Event group test tasks */                                                \
+    BEERTOS_TASK(OS_TASK_EVENT_ALL, ut_task_event_all, 128, false, NULL)        \
+    BEERTOS_TASK(OS_TASK_EVENT_ANY, ut_task_event_any, 128, false, NULL)        \
+    /* FromISR test tasks */                                                    \
+    BEERTOS_TASK(OS_TASK_ISR, ut_task_isr, 128, false, NULL)                    \
+    /* Task pool test tasks */                                                  \
+    UT_POOL_TASKS()                                                             \
+    /* Basic task test tasks */                                                 \
+    UT_BASIC_TASKS()                                                            \
+    /* Preemption threshold test tasks */                                       \
+    BEERTOS_TASK(OS_TASK_PT_HIGH, ut_threshold_task, 128, false, (void *)3)     \
+    BEERTOS_TASK(OS_TASK_PT_MID, ut_threshold_task, 128, false, (void *)2)      \
+    BEERTOS_THRESHOLD_TASK(OS_TASK_PT_LOW, ut_threshold_task, 128, false, (void *)1, OS_TASK_PT_MID) \
+    /* Scheduler benchmark tasks - fixed priority (rate monotonic) and EDF */   \
+    BEERTOS_TASK(OS_TASK_BM_RM_1, bm_sched_task, 128, false, (void *)0)         \
+    BEERTOS_TASK(OS_TASK_BM_RM_2, bm_sched_task, 128, false, (void *)1)         \
+    /* EDF group - test tasks and scheduler benchmark tasks */                  \
+    BEERTOS_EDF_TASK(OS_TASK_EDF_1, ut_edf_task, 128, false, (void *)1, 50)     \
+    BEERTOS_EDF_TASK(OS_TASK_EDF_2, ut_edf_task, 128, false, (void *)2, 10)     \
+    BEERTOS_EDF_TASK(OS_TASK_BM_EDF_1, bm_sched_task, 128, false, (void *)2, 50) \
+    BEERTOS_EDF_TASK(OS_TASK_BM_EDF_2, bm_sched_task, 128, false, (void *)3, 70) \
+    /* Periodic test task */                                                    \
+    BEERTOS_PERIODIC_TASK(OS_TASK_PERIODIC, ut_periodic_job, 128, 10, 3, 4)     \
+    /* Watchdog test task */                                                    \
+    BEERTOS_TASK(OS_TASK_WDG, ut_wdg_task, 128, false, NULL)
 
 /*! @brief BeeRTOS message list - define your messages here
  * Messages are more specific than queues, they can store only one type of data
@@ -119,10 +384,11 @@
  * @param messages_count - number of messages that can be stored in queue
  * @param message_size - size of single message in bytes
  */
-#define OS_MESSAGES_LIST()         \
-    OS_MESSAGE(MESSAGE_ONE, 2, 8)  \
-    OS_MESSAGE(MESSAGE_TWO, 10, 4) \
-    OS_MESSAGE(MESSAGE_THREE, 10, 4)
+#define OS_MESSAGES_LIST()           \
+    OS_MESSAGE(MESSAGE_ONE, 2, 8)    \
+    OS_MESSAGE(MESSAGE_TWO, 10, 4)   \
+    OS_MESSAGE(MESSAGE_THREE, 10, 4) \
+    OS_MESSAGE(MESSAGE_BM, 1, 4)
 
 /*! @brief BeeRTOS queue list - define your queues here
  *  Queues are more general than messages, they can store any type of data
@@ -153,7 +419,33 @@
 #define BEERTOS_SEMAPHORE_LIST()                                   \
     BEERTOS_SEMAPHORE(SEMAPHORE_UT1, 10U, SEMAPHORE_TYPE_COUNTING) \
     BEERTOS_SEMAPHORE(SEMAPHORE_UT2, 0U, SEMAPHORE_TYPE_BINARY)    \
-    BEERTOS_SEMAPHORE(SEMAPHORE_TWO, 0U, SEMAPHORE_TYPE_BINARY)
+    BEERTOS_SEMAPHORE(SEMAPHORE_TWO, 0U, SEMAPHORE_TYPE_BINARY)    \
+    BEERTOS_SEMAPHORE(SEMAPHORE_ISR, 0U, SEMAPHORE_TYPE_BINARY)    \
+    BEERTOS_SEMAPHORE(SEMAPHORE_BM, 0U, SEMAPHORE_TYPE_BINARY)
+
+/*! @brief BeeRTOS event group list - define your event groups here
+ * Event groups hold 32 event bits each. Tasks can block until any or all of the requested
+ * bits are set, one set operation releases all waiting tasks whose condition is met.
+ *
+ * Structure: BEERTOS_EVENT_GROUP(event_group_id)
+ * @param event_group_id - event group id (created in os_event_id_t enum), must be unique
+ */
+#define BEERTOS_EVENT_GROUP_LIST() \
+    BEERTOS_EVENT_GROUP(EVENT_GROUP_UT)
+
+/*! @brief BeeRTOS task pool - define the stack classes of dynamic tasks here
+ * Each stack class has a fixed number of slots, a slot holds the task control block and the
+ * stack of one task created by os_task_create_dynamic. Slots are allocated in O(1) without
+ * any heap, a slot is returned when the task calls os_task_delete.
+ *
+ * Structure: OS_STACK_CLASS(stack_class_id, stacksize, count)
+ * @param stack_class_id - stack class id (created in os_stack_class_t enum), must be unique
+ * @param stacksize - stack size of the class, in the same units as in BEERTOS_TASK
+ * @param count - number of slots of the class
+ */
+#define BEERTOS_TASK_POOL_LIST()                \
+    OS_STACK_CLASS(OS_STACK_CLASS_SMALL, 128, 2) \
+    OS_STACK_CLASS(OS_STACK_CLASS_LARGE, 256, 1)
 
 /*!
  *  @brief Define your alarms here
@@ -196,8 +488,44 @@ extern void mutex_high_priority_task(void *arg);
 extern void ut_task_msg_1(void *arg);
 extern void ut_task_msg_2(void *arg);
 
+extern void ut_task_rr(void *arg);
+
+extern void ut_task_notify(void *arg);
+
+extern void ut_task_event_all(void *arg);
+extern void ut_task_event_any(void *arg);
+extern void ut_task_isr(void *arg);
+
+extern void ut_basic_task(void *arg);
+
+extern void ut_threshold_task(void *arg);
+
+extern void ut_edf_task(void *arg);
+
+extern void ut_periodic_job(void);
+extern void ut_deadline_miss_cb(uint32_t task_id, uint32_t response_time);
+
+extern void ut_wdg_task(void *arg);
+extern void ut_wdg_miss_cb(uint32_t task_id);
+extern void ut_wdg_feed(void);
+
+extern void bm_task_partner(void *arg);
+extern void bm_sched_task(void *arg);
+
 extern void alarm1_callback(void);
 extern void alarm2_callback(void);
 extern void alarm3_callback(void);
 
+/******************************************************************************************
+ *                                   SMOKE TEST HOOKS                                     *
+ ******************************************************************************************/
+
+/* The smoke tests check the reported events, their callbacks replace the empty hooks above */
+#undef BEERTOS_DEADLINE_MISS_CB
+#define BEERTOS_DEADLINE_MISS_CB(task_id, response_time) ut_deadline_miss_cb((task_id), (response_time))
+#undef BEERTOS_WDG_MISS_CB
+#define BEERTOS_WDG_MISS_CB(task_id) ut_wdg_miss_cb(task_id)
+#undef BEERTOS_WDG_FEED
+#define BEERTOS_WDG_FEED() ut_wdg_feed()
+
 #endif /* __BEERTOS_CFG_H__ */
\ No newline at end of file
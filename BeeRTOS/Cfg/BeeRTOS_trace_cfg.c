@@ -25,6 +25,7 @@
 /******************************************************************************************
  *                                        FUNCTIONS                                       *
  ******************************************************************************************/
+#if (BEERTOS_USE_TRACE_RECORDER == false)
 void os_trace_send_task_info(os_task_t *task, char *name, uint32_t stack_size)
 {
     SEGGER_SYSVIEW_TASKINFO info;
@@ -37,3 +38,4 @@ void os_trace_send_task_info(os_task_t *task, char *name, uint32_t stack_size)
 
     SEGGER_SYSVIEW_SendTaskInfo(&info);
 }
+#endif /* BEERTOS_USE_TRACE_RECORDER */
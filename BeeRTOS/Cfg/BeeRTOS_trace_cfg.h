@@ -3,6 +3,8 @@
  * @file BeeRTOS_trace_cfg.h
  * This header file provides the configuration interface for real-time tracing in BeeRTOS,
  * facilitating the monitoring of system behavior, task scheduling, and inter-task communication.
+ * The hooks are mapped to the native trace recorder (BEERTOS_USE_TRACE_RECORDER) or to
+ * SEGGER SystemView.
  ******************************************************************************************/
 
 #ifndef __BEERTOS_TRACE_CFG_H__
@@ -12,8 +14,12 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
-#include "SEGGER_SYSVIEW.h"
 #include "BeeRTOS.h"
+#if (BEERTOS_USE_TRACE_RECORDER == true)
+/* Native trace recorder - defines all BEERTOS_TRACE_* hooks */
+#include "BeeRTOS_trace.h"
+#else
+#include "SEGGER_SYSVIEW.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -70,6 +76,13 @@
 /*! @brief Records a task unblocked event when a task is unblocked from a mutex */
 #define BEERTOS_TRACE_MUTEX_UNBLOCKED(task) {}
 
+/*! @brief Records a task blocked event when a task is blocked waiting for event bits */
+#define BEERTOS_TRACE_EVENT_BLOCKED(task) \
+    SEGGER_SYSVIEW_OnTaskStopReady((uint32_t)task, 4U)
+
+/*! @brief Records a task unblocked event when a task is unblocked by event bits */
+#define BEERTOS_TRACE_EVENT_UNBLOCKED(task) {}
+
 /*! @brief Records a priority inheritance event when 
  * a task temporarily inherits the priority of an another task */
 #define BEERTOS_TRACE_MUTEX_PRIORITY_INHERITANCE(task, priority) \
@@ -102,6 +115,7 @@
 
 /* @brief Records the timer stop event */
 #define BEERTOS_TRACE_ALARM_CANCEL(alarm_id) {}
+#endif /* BEERTOS_USE_TRACE_RECORDER */
 
 /******************************************************************************************
  *                                        TYPEDEFS                                        *
@@ -114,6 +128,8 @@
 /******************************************************************************************
  *                                   FUNCTION PROTOTYPES                                  *
  ******************************************************************************************/
+#if (BEERTOS_USE_TRACE_RECORDER == false)
 void os_trace_send_task_info(os_task_t *task, char *name, uint32_t stack_size);
+#endif
 
 #endif /* __BEERTOS_TRACE_CFG_H__ */
\ No newline at end of file
@@ -49,6 +49,30 @@
 #define OS_MESSAGE_INIT()
 #endif
 
+#if (BEERTOS_EVENT_MODULE_EN == true)
+#define OS_EVENT_INIT() os_event_module_init()
+#else
+#define OS_EVENT_INIT()
+#endif
+
+#if (BEERTOS_DEFER_MODULE_EN == true)
+#define OS_DEFER_INIT() os_defer_module_init()
+#else
+#define OS_DEFER_INIT()
+#endif
+
+#if (BEERTOS_WDG_MODULE_EN == true)
+#define OS_WDG_INIT() os_wdg_module_init()
+#define OS_WDG_TICK() os_wdg_tick()
+#else
+#define OS_WDG_INIT()
+#define OS_WDG_TICK()
+#endif
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true) && (BEERTOS_TICKLESS_IDLE_MIN_TICKS < 2U)
+#error "BEERTOS_TICKLESS_IDLE_MIN_TICKS must be greater or equal to 2"
+#endif
+
 /******************************************************************************************
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
@@ -57,15 +81,15 @@
  *                                        VARIABLES                                       *
  ******************************************************************************************/
 
-static volatile uint32_t os_isr_counter;
 static volatile uint32_t os_tick_counter;
 
 /******************************************************************************************
  *                                        FUNCTIONS                                       *
  ******************************************************************************************/
 extern void os_cpu_init(void);
-extern void os_port_disable_interrupts(void);
-extern void os_port_enable_interrupts(void);
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+extern uint32_t os_port_suppress_ticks_and_sleep(const uint32_t expected_ticks);
+#endif
 
 /**
  * @brief This function initializes the operating system. It initializes all the OS modules
@@ -77,56 +101,110 @@ extern void os_port_enable_interrupts(void);
  */
 void os_init(void)
 {
-    os_isr_counter = 0U;
     os_tick_counter = 0U;
 
+    /* Tasks started during the initialization are scheduled when it is done */
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
     os_task_module_init();
     OS_ALARM_INIT();
     OS_SEMAPHORE_INIT();
     OS_MUTEX_INIT();
     OS_QUEUE_INIT();
     OS_MESSAGE_INIT();
+    OS_EVENT_INIT();
+    OS_DEFER_INIT();
+    OS_WDG_INIT();
     os_cpu_init();
     BEERTOS_TRACE_INIT();
+
+    /* The first context switch is requested here */
+    os_leave_critical_section(crit_state);
 }
 
 /**
- * @brief This function enters critical section. It disables all interrupts. As many times
- * as os_enter_critical_section() is called, os_leave_critical_section() must be called to exit the critical
- * section.
+ * @brief This function processes one system tick. Called by the port tick interrupt handler,
+ * the scheduler is run at the end only if a task was woken up or its time slice expired.
  *
  * @param None
  * @return None
  */
-void os_enter_critical_section(void)
+void os_tick(void)
 {
-    os_port_disable_interrupts();
-    os_isr_counter++;
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_tick();
+    os_alarm_tick();
+    os_tick_counter++;
+    BEERTOS_TRACE_TICK(os_tick_counter);
+    OS_WDG_TICK();
+
+    os_leave_critical_section(crit_state);
 }
 
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
 /**
- * @brief This function exits critical section. If the number of calls to os_enter_critical_section()
- * is equal to the number of calls to os_leave_critical_section(), the interrupts will be enabled.
+ * @brief This function credits the ticks that elapsed while the tick interrupt was suppressed.
+ * Delayed tasks and alarms are advanced by the given number of ticks in one step.
+ * Must be called with interrupts disabled.
+ *
+ * @param ticks - number of ticks not processed by the tick handler
+ * @return None
+ */
+void os_tick_compensate(const uint32_t ticks)
+{
+    os_task_tick_compensate(ticks);
+    os_alarm_tick_compensate(ticks);
+    os_tick_counter += ticks;
+    BEERTOS_TRACE_TICK(os_tick_counter);
+    OS_WDG_TICK();
+}
+
+/**
+ * @brief This function is called by the idle task in the tickless idle mode. If no task is
+ * ready to run, it computes the number of ticks until the earliest delayed task, alarm or
+ * watchdog check is due, and asks the port to suppress the tick interrupt and sleep for that
+ * time. After wakeup, the ticks that elapsed during the sleep are credited with os_tick_compensate().
  *
  * @param None
  * @return None
  */
-void os_leave_critical_section(void)
+void os_tickless_idle(void)
 {
-    os_isr_counter--;
-    if (os_isr_counter == 0U)
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    uint32_t expected_ticks = os_task_get_next_wakeup();
+    const uint32_t alarm_ticks = os_alarm_get_next_expiry();
+
+    if (alarm_ticks < expected_ticks)
     {
-        os_port_enable_interrupts();
+        expected_ticks = alarm_ticks;
     }
-}
 
-void os_tick(void)
-{
-    os_task_tick();
-    os_alarm_tick();
-    os_tick_counter++;
-    BEERTOS_TRACE_TICK(os_tick_counter);
+#if (BEERTOS_WDG_MODULE_EN == true)
+    /* A deadlocked task has to be reported, even if no task or alarm is due */
+    const uint32_t wdg_ticks = os_wdg_get_next_check();
+
+    if (wdg_ticks < expected_ticks)
+    {
+        expected_ticks = wdg_ticks;
+    }
+#endif
+
+    if (expected_ticks >= BEERTOS_TICKLESS_IDLE_MIN_TICKS)
+    {
+        const uint32_t elapsed_ticks = os_port_suppress_ticks_and_sleep(expected_ticks);
+
+        if (elapsed_ticks > 0U)
+        {
+            os_tick_compensate(elapsed_ticks);
+        }
+    }
+
+    /* Interrupts that woke up the core are handled here */
+    os_leave_critical_section(crit_state);
 }
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
 
 /**
  * @brief This function returns the current tick. The tick count is used to measure time in the OS.
@@ -136,9 +214,9 @@ void os_tick(void)
  */
 uint32_t os_get_tick_count(void)
 {
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
     uint32_t tick_count = os_tick_counter;
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return tick_count;
 }
@@ -24,6 +24,9 @@
 #include "BeeRTOS_mutex.h"
 #include "BeeRTOS_message.h"
 #include "BeeRTOS_queue.h"
+#include "BeeRTOS_event.h"
+#include "BeeRTOS_defer.h"
+#include "BeeRTOS_wdg.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -41,8 +44,73 @@
  *                                   FUNCTION PROTOTYPES                                  *
  ******************************************************************************************/
 void os_init(void);
-void os_enter_critical_section(void);
-void os_leave_critical_section(void);
 uint32_t os_get_tick_count(void);
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+void os_tick_compensate(const uint32_t ticks);
+void os_tickless_idle(void);
+#endif
+
+/**
+ * @brief This function enters critical section. It masks the interrupts used by the kernel -
+ * with BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0 the interrupts with a higher priority
+ * stay enabled and must not call the OS API. Critical sections can be nested, the returned
+ * state must be passed to the matching os_leave_critical_section().
+ *
+ * @param None
+ * @return interrupt mask state before entering the critical section
+ */
+static inline os_crit_state_t os_enter_critical_section(void)
+{
+    return os_port_enter_critical();
+}
+
+/**
+ * @brief This function exits critical section and restores the interrupt mask state saved by
+ * os_enter_critical_section(). When the outermost critical section is left and the scheduler
+ * was requested inside it, the scheduler is run once before the interrupts are unmasked,
+ * so the pended context switch is taken right after.
+ *
+ * @param state - value returned by the matching os_enter_critical_section()
+ * @return None
+ */
+static inline void os_leave_critical_section(const os_crit_state_t state)
+{
+    if ((0U == state) && os_sched_pending)
+    {
+        os_sched_process();
+    }
+    os_port_leave_critical(state);
+}
+
+/**
+ * @brief This function enters critical section in an interrupt handler. Used by the FromISR
+ * variants of the OS API, must be paired with os_leave_critical_section_from_isr().
+ *
+ * @param None
+ * @return interrupt mask state before entering the critical section
+ */
+static inline os_crit_state_t os_enter_critical_section_from_isr(void)
+{
+    return os_port_enter_critical();
+}
+
+/**
+ * @brief This function exits critical section in an interrupt handler. The scheduler is never
+ * run here - if a task with a higher priority than the interrupted task became ready,
+ * task_woken is set and the context switch is requested by os_port_yield_from_isr().
+ *
+ * @param state - value returned by the matching os_enter_critical_section_from_isr()
+ * @param task_woken - optional, set to true if a context switch is needed, left unchanged
+ *                     otherwise (one flag can be shared by several calls in one interrupt)
+ * @return None
+ */
+static inline void os_leave_critical_section_from_isr(const os_crit_state_t state, bool *const task_woken)
+{
+    if ((NULL != task_woken) && os_sched_pending && os_task_higher_priority_ready())
+    {
+        *task_woken = true;
+    }
+    os_port_leave_critical(state);
+}
 
 #endif /* __BEERTOS_H__ */
\ No newline at end of file
@@ -34,25 +34,20 @@
 /*! Check and select the proper mask type for the number of configured alarms */
 #if (OS_ALARM_COUNT <= 8U)
     typedef uint8_t os_alarm_active_mask_t;
+    #define OS_ALARM_GET_HIGHEST_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK8(mask)
 #elif (OS_ALARM_COUNT <= 16U)
     typedef uint16_t os_alarm_active_mask_t;
+    #define OS_ALARM_GET_HIGHEST_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK16(mask)
 #elif (OS_ALARM_COUNT <= 32U)
     typedef uint32_t os_alarm_active_mask_t;
+    #define OS_ALARM_GET_HIGHEST_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask)
 #elif (OS_ALARM_COUNT <= 64U)
     typedef uint64_t os_alarm_active_mask_t;
+    #define OS_ALARM_GET_HIGHEST_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK64(mask)
 #else
     #error "BEERTOS_ALARM_ID_MAX must be less or equal to 64"
 #endif
 
-/*! Structure to hold alarm data */
-typedef struct
-{
-    uint32_t    period;
-    bool        periodic;
-    void        (*callback)(void);
-    uint32_t    remaining_time;
-} os_alarm_t;
-
 /******************************************************************************************
  *                                        VARIABLES                                       *
  ******************************************************************************************/
@@ -131,13 +126,13 @@ void os_alarm_start(const os_alarm_id_t alarm_id, const uint32_t period, const b
 
     os_alarm_t *const alarm = &os_alarms[alarm_id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
     alarm->period = period;
     alarm->periodic = periodic;
     alarm->remaining_time = period;
 
     OS_ALARM_SET_MASK(os_alarm_active_mask, alarm_id);
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     BEERTOS_TRACE_ALARM_START(alarm_id, period, periodic);
 }
@@ -158,11 +153,11 @@ void os_alarm_cancel(const os_alarm_id_t alarm_id)
                    OS_MODULE_ID_ALARM,
                    OS_ERROR_INVALID_PARAM);
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
     os_alarms[alarm_id].remaining_time = 0U;
     OS_ALARM_CLEAR_MASK(os_alarm_active_mask, alarm_id);
     OS_ALARM_CLEAR_MASK(os_alarm_pending_mask, alarm_id);
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     BEERTOS_TRACE_ALARM_CANCEL(alarm_id);
 }
@@ -180,23 +175,23 @@ uint32_t os_alarm_get_remaining_time(const os_alarm_id_t alarm_id)
                    OS_MODULE_ID_ALARM,
                    OS_ERROR_INVALID_PARAM);
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
     const uint32_t remaining_time = os_alarms[alarm_id].remaining_time;
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return remaining_time;
 }
 
 /**
- * @brief This function is called by the OS tick handler.
- * Decrements remaining time of active alarms and schedules callbacks.
+ * @brief Decrements remaining time of active alarms by the given number of ticks and
+ * schedules callbacks of the expired ones.
  * 
- * @param None
+ * @param ticks - number of elapsed ticks
  * @return None
  */
-void os_alarm_tick(void)
+static inline void os_alarm_advance(const uint32_t ticks)
 {
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if there are any active alarms */
     if (0U != os_alarm_active_mask)
@@ -210,7 +205,8 @@ void os_alarm_tick(void)
 
                 if (alarm->remaining_time > 0U)
                 {
-                    alarm->remaining_time--;
+                    alarm->remaining_time = (alarm->remaining_time > ticks) ?
+                                            (alarm->remaining_time - ticks) : 0U;
 
                     if (0U == alarm->remaining_time)
                     {
@@ -228,8 +224,63 @@ void os_alarm_tick(void)
         }
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief This function is called by the OS tick handler.
+ * Decrements remaining time of active alarms and schedules callbacks.
+ * 
+ * @param None
+ * @return None
+ */
+void os_alarm_tick(void)
+{
+    os_alarm_advance(1U);
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/**
+ * @brief This function processes the ticks that elapsed while the tick interrupt was
+ * suppressed. Must be called with interrupts disabled.
+ * 
+ * @param ticks - number of elapsed ticks
+ * @return None
+ */
+void os_alarm_tick_compensate(const uint32_t ticks)
+{
+    os_alarm_advance(ticks);
+}
+
+/**
+ * @brief This function returns the number of ticks until the earliest active alarm expires.
+ * Must be called with interrupts disabled.
+ * 
+ * @param None
+ * @return UINT32_MAX if no alarm is active, otherwise the number of ticks until the next expiry
+ */
+uint32_t os_alarm_get_next_expiry(void)
+{
+    uint32_t next_expiry = UINT32_MAX;
+
+    if (0U != os_alarm_active_mask)
+    {
+        for (os_alarm_id_t id = 0U; id < BEERTOS_ALARM_ID_MAX; id++)
+        {
+            const os_alarm_t *const alarm = &os_alarms[id];
+
+            if ((os_alarm_active_mask & (1ULL << id)) &&
+                (alarm->remaining_time > 0U) &&
+                (alarm->remaining_time < next_expiry))
+            {
+                next_expiry = alarm->remaining_time;
+            }
+        }
+    }
+
+    return next_expiry;
 }
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
 
 /**
  * @brief This function is the task that is responsible for calling the alarm callbacks.
@@ -244,14 +295,14 @@ void os_alarm_task(void *const arg)
     /* While 1, because the task is stopped after processing the alarms */
     while (1)
     {
-        os_enter_critical_section();
+        os_crit_state_t crit_state = os_enter_critical_section();
         os_alarm_active_mask_t mask = os_alarm_pending_mask;
-        os_leave_critical_section();
+        os_leave_critical_section(crit_state);
 
         /* Process all pending alarms */
         while (mask)
         {
-            const os_alarm_id_t id = OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask) - 1U;
+            const os_alarm_id_t id = OS_ALARM_GET_HIGHEST_FROM_MASK(mask) - 1U;
             os_alarm_t *const alarm = &os_alarms[id];
             BEERTOS_ASSERT(alarm->callback != NULL,
                            OS_MODULE_ID_ALARM,
@@ -259,7 +310,7 @@ void os_alarm_task(void *const arg)
 
             alarm->callback();
 
-            os_enter_critical_section();
+            crit_state = os_enter_critical_section();
             /* Rearm the alarm if it is periodic, otherwise disable it */
             if (alarm->periodic)
             {
@@ -272,7 +323,7 @@ void os_alarm_task(void *const arg)
             }
 
             OS_ALARM_CLEAR_MASK(os_alarm_pending_mask, id);
-            os_leave_critical_section();
+            os_leave_critical_section(crit_state);
 
             /* Update the mask to exclude the just processed alarm */
             OS_ALARM_CLEAR_MASK(mask, id);
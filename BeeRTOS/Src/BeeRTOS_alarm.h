@@ -13,7 +13,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
-#include "Beertos_internal.h"
+#include "BeeRTOS_internal.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -34,6 +34,15 @@ typedef enum
     BEERTOS_ALARM_ID_MAX
 } os_alarm_id_t;
 
+/*! Structure to hold alarm data */
+typedef struct
+{
+    uint32_t    period;
+    bool        periodic;
+    void        (*callback)(void);
+    uint32_t    remaining_time;
+} os_alarm_t;
+
 /******************************************************************************************
  *                                    GLOBAL VARIABLES                                    *
  ******************************************************************************************/
@@ -47,6 +56,10 @@ void os_alarm_start(const os_alarm_id_t alarm_id, const uint32_t period, const b
 void os_alarm_cancel(const os_alarm_id_t alarm_id);
 uint32_t os_alarm_get_remaining_time(const os_alarm_id_t alarm_id);
 void os_alarm_tick(void);
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+void os_alarm_tick_compensate(const uint32_t ticks);
+uint32_t os_alarm_get_next_expiry(void);
+#endif
 void os_alarm_task(void *arg);
 
 #endif /* __BEERTOS_ALARM_H__ */
\ No newline at end of file
@@ -56,6 +56,9 @@ typedef enum
     OS_MODULE_ID_SEMAPHORE,
     OS_MODULE_ID_QUEUE,
     OS_MODULE_ID_MESSAGE,
+    OS_MODULE_ID_EVENT,
+    OS_MODULE_ID_DEFER,
+    OS_MODULE_ID_WDG,
 
     BEERTOS_ASSERT_USER_LIST()
 
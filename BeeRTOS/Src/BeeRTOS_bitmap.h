@@ -0,0 +1,194 @@
+/******************************************************************************************
+ * @brief Header file for BeeRTOS task priority bitmaps
+ * @file BeeRTOS_bitmap.h
+ * This header file implements the priority bitmap used for all task masks in BeeRTOS - the
+ * ready and delay masks of the scheduler and the masks of tasks waiting on semaphores and
+ * messages. One bit represents one priority (bit 0 is priority 1, the idle task is never
+ * stored in a mask). Up to 32 tasks a single word is used, above that the bitmap has two
+ * levels: a group word, where bit n is set if the n-th word of the bitmap is not empty, and
+ * the per-group words. Finding the highest priority stays O(1) and uses only 32-bit CLZ.
+ * Must be included after OS_TASK_COUNT is defined (by BeeRTOS_task.h).
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_BITMAP_H__
+#define __BEERTOS_BITMAP_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS_internal.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/*! Number of bits in a single bitmap word */
+#define OS_TASK_MASK_WORD_BITS (32U)
+
+#if OS_TASK_COUNT <= OS_TASK_MASK_WORD_BITS
+    #define OS_TASK_MASK_TWO_LEVEL (false)
+#elif OS_TASK_COUNT <= (OS_TASK_MASK_WORD_BITS * OS_TASK_MASK_WORD_BITS)
+    #define OS_TASK_MASK_TWO_LEVEL (true)
+    /*! Number of words in the second level of the bitmap */
+    #define OS_TASK_MASK_WORDS ((OS_TASK_COUNT + OS_TASK_MASK_WORD_BITS - 2U) / OS_TASK_MASK_WORD_BITS)
+#else
+    #error "OS_TASK_MAX must be less or equal to 1024"
+#endif
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/*! Check and select the proper mask type for the number of configured tasks */
+#if (OS_TASK_MASK_TWO_LEVEL == true)
+    typedef struct
+    {
+        uint32_t group;                     /*!< bit n is set if words[n] is not empty */
+        uint32_t words[OS_TASK_MASK_WORDS]; /*!< bit b of words[n] is priority n * 32 + b + 1 */
+    } os_task_mask_t;
+#elif OS_TASK_COUNT <= 8U
+    typedef uint8_t os_task_mask_t;
+#elif OS_TASK_COUNT <= 16U
+    typedef uint16_t os_task_mask_t;
+#else
+    typedef uint32_t os_task_mask_t;
+#endif
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+#if (OS_TASK_MASK_TWO_LEVEL == true)
+
+static inline void os_task_mask_reset(os_task_mask_t *const mask)
+{
+    mask->group = 0U;
+    for (uint32_t i = 0U; i < OS_TASK_MASK_WORDS; i++)
+    {
+        mask->words[i] = 0U;
+    }
+}
+
+static inline void os_task_mask_set(os_task_mask_t *const mask, const uint32_t priority)
+{
+    const uint32_t word = (priority - 1U) / OS_TASK_MASK_WORD_BITS;
+
+    mask->words[word] |= (1UL << ((priority - 1U) % OS_TASK_MASK_WORD_BITS));
+    mask->group |= (1UL << word);
+}
+
+static inline void os_task_mask_clear(os_task_mask_t *const mask, const uint32_t priority)
+{
+    const uint32_t word = (priority - 1U) / OS_TASK_MASK_WORD_BITS;
+
+    mask->words[word] &= ~(1UL << ((priority - 1U) % OS_TASK_MASK_WORD_BITS));
+    if (0U == mask->words[word])
+    {
+        mask->group &= ~(1UL << word);
+    }
+}
+
+static inline bool os_task_mask_test(const os_task_mask_t *const mask, const uint32_t priority)
+{
+    const uint32_t word = (priority - 1U) / OS_TASK_MASK_WORD_BITS;
+
+    return (0U != (mask->words[word] & (1UL << ((priority - 1U) % OS_TASK_MASK_WORD_BITS))));
+}
+
+static inline bool os_task_mask_is_empty(const os_task_mask_t *const mask)
+{
+    return (0U == mask->group);
+}
+
+/* The mask must not be empty */
+static inline uint32_t os_task_mask_get_highest(const os_task_mask_t *const mask)
+{
+    const uint32_t word = OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask->group) - 1U;
+
+    return (word * OS_TASK_MASK_WORD_BITS) + OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask->words[word]);
+}
+
+/* Returns the highest priority in the mask lower or equal to the limit, 0 if there is none */
+static inline uint32_t os_task_mask_get_highest_below(const os_task_mask_t *const mask, const uint32_t limit)
+{
+    if (0U == limit)
+    {
+        return 0U;
+    }
+
+    const uint32_t word = (limit - 1U) / OS_TASK_MASK_WORD_BITS;
+    const uint32_t bit = (limit - 1U) % OS_TASK_MASK_WORD_BITS;
+    const uint32_t bits = mask->words[word] & (0xFFFFFFFFUL >> (OS_TASK_MASK_WORD_BITS - 1U - bit));
+
+    if (0U != bits)
+    {
+        return (word * OS_TASK_MASK_WORD_BITS) + OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(bits);
+    }
+
+    const uint32_t groups = mask->group & ((1UL << word) - 1U);
+
+    if (0U != groups)
+    {
+        const uint32_t lower_word = OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(groups) - 1U;
+
+        return (lower_word * OS_TASK_MASK_WORD_BITS) +
+               OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask->words[lower_word]);
+    }
+
+    return 0U;
+}
+
+#else
+
+static inline void os_task_mask_reset(os_task_mask_t *const mask)
+{
+    *mask = 0U;
+}
+
+static inline void os_task_mask_set(os_task_mask_t *const mask, const uint32_t priority)
+{
+    *mask |= (os_task_mask_t)(1UL << (priority - 1U));
+}
+
+static inline void os_task_mask_clear(os_task_mask_t *const mask, const uint32_t priority)
+{
+    *mask &= (os_task_mask_t)~(1UL << (priority - 1U));
+}
+
+static inline bool os_task_mask_test(const os_task_mask_t *const mask, const uint32_t priority)
+{
+    return (0U != (*mask & (1UL << (priority - 1U))));
+}
+
+static inline bool os_task_mask_is_empty(const os_task_mask_t *const mask)
+{
+    return (0U == *mask);
+}
+
+/* The mask must not be empty */
+static inline uint32_t os_task_mask_get_highest(const os_task_mask_t *const mask)
+{
+    return OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32((uint32_t)*mask);
+}
+
+/* Returns the highest priority in the mask lower or equal to the limit, 0 if there is none */
+static inline uint32_t os_task_mask_get_highest_below(const os_task_mask_t *const mask, const uint32_t limit)
+{
+    if (0U == limit)
+    {
+        return 0U;
+    }
+
+    const uint32_t bits = (uint32_t)*mask & (0xFFFFFFFFUL >> (OS_TASK_MASK_WORD_BITS - limit));
+
+    return (0U != bits) ? OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(bits) : 0U;
+}
+
+#endif /* OS_TASK_MASK_TWO_LEVEL */
+
+#endif /* __BEERTOS_BITMAP_H__ */
@@ -0,0 +1,145 @@
+/******************************************************************************************
+ * @brief Source file for BeeRTOS deferred interrupt processing
+ * @file BeeRTOS_defer.c
+ * This file implements the deferred interrupt processing for BeeRTOS. Interrupt handlers
+ * post callbacks to a fixed-size ring without entering a critical section - a slot is
+ * reserved by an atomic compare-and-swap of the head index, so nested interrupts can post
+ * at the same time. The defer task is started by the first posted entry and runs all the
+ * posted callbacks in one batch, then it stops until new work is posted.
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#include "BeeRTOS_defer.h"
+#include "BeeRTOS_assert.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+#if (BEERTOS_DEFER_MODULE_EN == true)
+
+#if ((BEERTOS_DEFER_QUEUE_SIZE & (BEERTOS_DEFER_QUEUE_SIZE - 1U)) != 0U) || (BEERTOS_DEFER_QUEUE_SIZE == 0U)
+#error "BEERTOS_DEFER_QUEUE_SIZE must be a power of 2"
+#endif
+
+#define OS_DEFER_INDEX_MASK (BEERTOS_DEFER_QUEUE_SIZE - 1U)
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        VARIABLES                                       *
+ ******************************************************************************************/
+
+/*! Ring of deferred work, head and tail are free running indexes */
+static os_defer_entry_t os_defer_ring[BEERTOS_DEFER_QUEUE_SIZE];
+static volatile uint32_t os_defer_head;
+static volatile uint32_t os_defer_tail;
+
+/******************************************************************************************
+ *                                        FUNCTIONS                                       *
+ ******************************************************************************************/
+
+/**
+ * @brief The function initializes the deferred work ring.
+ * Called once (automatically) in os system initialization.
+ *
+ * @param None
+ * @return None
+ */
+void os_defer_module_init(void)
+{
+    os_defer_head = 0U;
+    os_defer_tail = 0U;
+
+    for (uint32_t i = 0U; i < BEERTOS_DEFER_QUEUE_SIZE; i++)
+    {
+        os_defer_ring[i].ready = false;
+    }
+}
+
+/**
+ * @brief Post a callback to be run by the defer task. Never blocks and does not enter a
+ * critical section until the entry is posted - only starting the defer task does.
+ * Call os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param fn - callback run in the defer task context
+ * @param arg - argument passed to the callback
+ * @param task_woken - optional, set to true if the defer task has a higher priority than the
+ *                     interrupted task
+ * @return true if the work was posted, false if the ring is full
+ */
+bool os_defer_from_isr(const os_defer_fn_t fn, void *const arg, bool *const task_woken)
+{
+    BEERTOS_ASSERT(fn != NULL, OS_MODULE_ID_DEFER, OS_ERROR_NULLPTR);
+
+    uint32_t head = __atomic_load_n(&os_defer_head, __ATOMIC_RELAXED);
+
+    /* Reserve the slot, retried only if a nested interrupt posted in the meantime */
+    do
+    {
+        if ((head - __atomic_load_n(&os_defer_tail, __ATOMIC_ACQUIRE)) >= BEERTOS_DEFER_QUEUE_SIZE)
+        {
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&os_defer_head, &head, head + 1U, true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    os_defer_entry_t *const entry = &os_defer_ring[head & OS_DEFER_INDEX_MASK];
+
+    entry->fn = fn;
+    entry->arg = arg;
+    __atomic_store_n(&entry->ready, true, __ATOMIC_RELEASE);
+
+    (void)os_task_start_from_isr(OS_DEFER_TASK, task_woken);
+
+    return true;
+}
+
+/**
+ * @brief This function is the task that runs the deferred callbacks. It is started by
+ * os_defer_from_isr, runs all the posted work and stops when the ring is empty.
+ *
+ * @param arg - not used
+ * @return None
+ */
+void os_defer_task(void *const arg)
+{
+    (void)arg;
+
+    /* While 1, because the task is stopped after processing the work */
+    while (1)
+    {
+        os_defer_entry_t *entry = &os_defer_ring[os_defer_tail & OS_DEFER_INDEX_MASK];
+
+        /* Run all the work posted so far */
+        while (__atomic_load_n(&entry->ready, __ATOMIC_ACQUIRE))
+        {
+            const os_defer_fn_t fn = entry->fn;
+            void *const work_arg = entry->arg;
+
+            /* Release the slot before the callback, so it can be reused by the interrupts */
+            entry->ready = false;
+            __atomic_store_n(&os_defer_tail, os_defer_tail + 1U, __ATOMIC_RELEASE);
+
+            fn(work_arg);
+
+            entry = &os_defer_ring[os_defer_tail & OS_DEFER_INDEX_MASK];
+        }
+
+        /* A slot reserved by an interrupt, but not written yet, is left for the next batch -
+           the interrupt starts the task again when the entry is ready */
+        const os_crit_state_t crit_state = os_enter_critical_section();
+        if (!entry->ready)
+        {
+            os_task_stop(OS_DEFER_TASK);
+        }
+        os_leave_critical_section(crit_state);
+    }
+}
+#endif /* BEERTOS_DEFER_MODULE_EN */
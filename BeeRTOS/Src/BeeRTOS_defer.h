@@ -0,0 +1,50 @@
+/******************************************************************************************
+ * @brief Header file for BeeRTOS deferred interrupt processing
+ * @file BeeRTOS_defer.h
+ * This header file defines the interface for the deferred interrupt processing in BeeRTOS.
+ * Interrupt handlers hand off work (a callback with one argument) to the defer task, which
+ * is declared with BEERTOS_DEFER_TASK in BEERTOS_PRIORITY_LIST and runs the callbacks in
+ * task context. The work is stored in a lock-free ring of BEERTOS_DEFER_QUEUE_SIZE entries.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_DEFER_H__
+#define __BEERTOS_DEFER_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS_internal.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/*! Deferred work callback, called by the defer task with the argument passed to os_defer_from_isr */
+typedef void (*os_defer_fn_t)(void *arg);
+
+/*! Single deferred work entry */
+typedef struct
+{
+    os_defer_fn_t fn;
+    void *arg;
+    volatile bool ready; /* set by the producer when fn and arg are written */
+} os_defer_entry_t;
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+void os_defer_module_init(void);
+bool os_defer_from_isr(const os_defer_fn_t fn, void *const arg, bool *const task_woken);
+void os_defer_task(void *arg);
+
+#endif /* __BEERTOS_DEFER_H__ */
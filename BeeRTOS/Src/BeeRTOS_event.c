@@ -0,0 +1,261 @@
+/******************************************************************************************
+ * @brief Source file for BeeRTOS event groups
+ * @file BeeRTOS_event.c
+ * This file implements event groups for BeeRTOS. Each event group holds 32 event bits and
+ * a mask of the waiting tasks. The wait condition of a blocked task (requested bits, any/all,
+ * clear on exit) is stored per task priority, so one os_event_set() call checks all waiters
+ * and releases every satisfied one in a single critical section - the scheduler then runs
+ * only once, no matter how many tasks were released.
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#include "BeeRTOS_event.h"
+#include "BeeRTOS_task.h"
+#include "BeeRTOS_assert.h"
+#include "BeeRTOS_trace_cfg.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        VARIABLES                                       *
+ ******************************************************************************************/
+
+extern os_task_t *os_tasks[OS_TASK_MAX];
+extern os_task_t *volatile os_task_current;
+
+/*! List of all event groups */
+static os_event_group_t os_event_groups[BEERTOS_EVENT_GROUP_ID_MAX];
+
+/*! Wait conditions of the blocked tasks, indexed by priority */
+static os_event_waiter_t os_event_waiters[OS_TASK_MAX];
+
+/******************************************************************************************
+ *                                        FUNCTIONS                                       *
+ ******************************************************************************************/
+
+static inline bool os_event_is_satisfied(const uint32_t event_bits,
+                                         const uint32_t bits,
+                                         const bool wait_all)
+{
+    return wait_all ? ((event_bits & bits) == bits) : ((event_bits & bits) != 0U);
+}
+
+/**
+ * @brief The function initializes the operating system's event groups.
+ * Called once (automatically) in os system initialization.
+ *
+ * @param None
+ * @return None
+ */
+void os_event_module_init(void)
+{
+    for (uint32_t i = 0U; i < BEERTOS_EVENT_GROUP_ID_MAX; i++)
+    {
+        os_event_groups[i].bits = 0U;
+        os_task_mask_reset(&os_event_groups[i].tasks_waiting);
+    }
+}
+
+/**
+ * @brief Set event bits. All waiting tasks whose condition is met are released; the bits
+ * requested with clear_on_exit by the released tasks are cleared after all waiters are checked,
+ * so every waiter sees the same event bits. Use os_event_set_from_isr() in interrupts.
+ *
+ * @param id - event group id
+ * @param bits - bits to be set
+ * @return event bits after the released tasks cleared their bits
+ */
+uint32_t os_event_set(const os_event_id_t id, const uint32_t bits)
+{
+    BEERTOS_ASSERT(id < BEERTOS_EVENT_GROUP_ID_MAX,
+                   OS_MODULE_ID_EVENT,
+                   OS_ERROR_INVALID_PARAM);
+
+    os_event_group_t *const group = &os_event_groups[id];
+    uint32_t bits_to_clear = 0U;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    group->bits |= bits;
+
+    os_task_mask_t waiting = group->tasks_waiting;
+    while (!os_task_mask_is_empty(&waiting))
+    {
+        const uint32_t priority = os_task_mask_get_highest(&waiting);
+        os_event_waiter_t *const waiter = &os_event_waiters[priority];
+
+        os_task_mask_clear(&waiting, priority);
+
+        if (os_event_is_satisfied(group->bits, waiter->bits, waiter->wait_all))
+        {
+            if (waiter->clear_on_exit)
+            {
+                bits_to_clear |= waiter->bits;
+            }
+            /* Pass the event bits to the released task */
+            waiter->bits = group->bits;
+
+            os_task_mask_clear(&group->tasks_waiting, priority);
+            (void)os_task_start(OS_GET_TASK_ID_FROM_PRIORITY(priority));
+            BEERTOS_TRACE_EVENT_UNBLOCKED(os_tasks[priority]);
+        }
+    }
+
+    group->bits &= ~bits_to_clear;
+    const uint32_t event_bits = group->bits;
+
+    /* Released tasks are scheduled when leaving the critical section */
+    os_leave_critical_section(crit_state);
+
+    return event_bits;
+}
+
+/**
+ * @brief Set event bits from an interrupt, see os_event_set(). The released tasks are not
+ * scheduled here, call os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param id - event group id
+ * @param bits - bits to be set
+ * @param task_woken - optional, set to true if a task with a higher priority than the
+ *                     interrupted task was released
+ * @return event bits after the released tasks cleared their bits
+ */
+uint32_t os_event_set_from_isr(const os_event_id_t id, const uint32_t bits, bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const uint32_t event_bits = os_event_set(id, bits);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
+
+    return event_bits;
+}
+
+/**
+ * @brief Clear event bits. Can be called from an interrupt.
+ *
+ * @param id - event group id
+ * @param bits - bits to be cleared
+ * @return event bits before they were cleared
+ */
+uint32_t os_event_clear(const os_event_id_t id, const uint32_t bits)
+{
+    BEERTOS_ASSERT(id < BEERTOS_EVENT_GROUP_ID_MAX,
+                   OS_MODULE_ID_EVENT,
+                   OS_ERROR_INVALID_PARAM);
+
+    os_event_group_t *const group = &os_event_groups[id];
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    const uint32_t event_bits = group->bits;
+    group->bits &= ~bits;
+
+    os_leave_critical_section(crit_state);
+
+    return event_bits;
+}
+
+/**
+ * @brief Get event bits.
+ *
+ * @param id - event group id
+ * @return current event bits
+ */
+uint32_t os_event_get(const os_event_id_t id)
+{
+    BEERTOS_ASSERT(id < BEERTOS_EVENT_GROUP_ID_MAX,
+                   OS_MODULE_ID_EVENT,
+                   OS_ERROR_INVALID_PARAM);
+
+    return os_event_groups[id].bits;
+}
+
+/**
+ * @brief Wait until any or all of the requested event bits are set. If the condition is not
+ * met, the task is blocked until an os_event_set() call meets it or the timeout expires.
+ *
+ * @param id - event group id
+ * @param bits - requested bits, must not be 0
+ * @param any_or_all - OS_EVENT_WAIT_ANY or OS_EVENT_WAIT_ALL
+ * @param clear_on_exit - if true, the requested bits are cleared when the condition is met
+ * @param timeout - maximum time to wait in ticks, 0 to return immediately
+ * @return event bits when the condition was met (before clearing), or when the timeout
+ *         expired - the caller checks the returned bits to find out which case occurred
+ */
+uint32_t os_event_wait(const os_event_id_t id,
+                       const uint32_t bits,
+                       const os_event_wait_mode_t any_or_all,
+                       const bool clear_on_exit,
+                       const uint32_t timeout)
+{
+    BEERTOS_ASSERT(id < BEERTOS_EVENT_GROUP_ID_MAX,
+                   OS_MODULE_ID_EVENT,
+                   OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(bits != 0U,
+                   OS_MODULE_ID_EVENT,
+                   OS_ERROR_INVALID_PARAM);
+
+    os_event_group_t *const group = &os_event_groups[id];
+    const os_task_prio_t current_task_priority = os_task_current->priority;
+    const bool wait_all = (any_or_all == OS_EVENT_WAIT_ALL);
+    uint32_t event_bits;
+
+    os_crit_state_t crit_state = os_enter_critical_section();
+
+    event_bits = group->bits;
+
+    if (os_event_is_satisfied(event_bits, bits, wait_all))
+    {
+        if (clear_on_exit)
+        {
+            group->bits &= ~bits;
+        }
+    }
+    else if (0U != timeout)
+    {
+        os_event_waiter_t *const waiter = &os_event_waiters[current_task_priority];
+
+        /* Block the task, the condition is checked by os_event_set */
+        waiter->bits = bits;
+        waiter->wait_all = wait_all;
+        waiter->clear_on_exit = clear_on_exit;
+        os_task_mask_set(&group->tasks_waiting, current_task_priority);
+        os_delay(timeout);
+        BEERTOS_TRACE_EVENT_BLOCKED(os_task_current);
+
+        os_leave_critical_section(crit_state);
+        /* Potencial context switch is right here */
+        crit_state = os_enter_critical_section();
+
+        if (os_task_mask_test(&group->tasks_waiting, current_task_priority))
+        {
+            /* Timeout, the task was not released by os_event_set */
+            os_task_mask_clear(&group->tasks_waiting, current_task_priority);
+            event_bits = group->bits;
+        }
+        else
+        {
+            /* Released by os_event_set, which stored the event bits */
+            event_bits = waiter->bits;
+        }
+    }
+    else
+    {
+        /* There is no timeout and the condition is not met */
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return event_bits;
+}
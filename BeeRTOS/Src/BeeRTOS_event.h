@@ -0,0 +1,76 @@
+/******************************************************************************************
+ * @brief Header file for BeeRTOS event groups
+ * @file BeeRTOS_event.h
+ * This header file defines the interface for event groups within BeeRTOS. An event group is
+ * a set of 32 event bits, tasks can block until any or all of the requested bits are set.
+ * It declares the enumeration for event group identifiers, based on the system configuration,
+ * and provides prototypes for functions to set, clear and wait for event bits.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_EVENT_H__
+#define __BEERTOS_EVENT_H__
+
+/******************************************************************************************
+*                                        INCLUDES                                        *
+******************************************************************************************/
+
+#include "BeeRTOS_internal.h"
+#include "BeeRTOS_task.h"
+
+/******************************************************************************************
+*                                         DEFINES                                        *
+******************************************************************************************/
+
+/******************************************************************************************
+*                                        TYPEDEFS                                        *
+******************************************************************************************/
+
+#undef BEERTOS_EVENT_GROUP
+#define BEERTOS_EVENT_GROUP(name, ...) name,
+typedef enum
+{
+    BEERTOS_EVENT_GROUP_LIST()
+    BEERTOS_EVENT_GROUP_ID_MAX
+} os_event_id_t;
+
+/*! Condition used by os_event_wait() */
+typedef enum
+{
+    OS_EVENT_WAIT_ANY = 0,  /* at least one of the requested bits is set */
+    OS_EVENT_WAIT_ALL,      /* all requested bits are set */
+} os_event_wait_mode_t;
+
+/*! Structure to hold event group data */
+typedef struct
+{
+    uint32_t bits;                /* event bits */
+    os_task_mask_t tasks_waiting; /* one bit represents one task */
+} os_event_group_t;
+
+/*! Wait condition of a blocked task */
+typedef struct
+{
+    uint32_t bits;       /* requested bits, event bits when the task was released */
+    bool wait_all;       /* all requested bits must be set */
+    bool clear_on_exit;  /* requested bits are cleared when the condition is met */
+} os_event_waiter_t;
+
+/******************************************************************************************
+*                                    GLOBAL VARIABLES                                    *
+******************************************************************************************/
+
+/******************************************************************************************
+*                                   FUNCTION PROTOTYPES                                  *
+******************************************************************************************/
+void os_event_module_init(void);
+uint32_t os_event_set(const os_event_id_t id, const uint32_t bits);
+uint32_t os_event_set_from_isr(const os_event_id_t id, const uint32_t bits, bool *const task_woken);
+uint32_t os_event_clear(const os_event_id_t id, const uint32_t bits);
+uint32_t os_event_get(const os_event_id_t id);
+uint32_t os_event_wait(const os_event_id_t id,
+                       const uint32_t bits,
+                       const os_event_wait_mode_t any_or_all,
+                       const bool clear_on_exit,
+                       const uint32_t timeout);
+
+#endif /* __BEERTOS_EVENT_H__ */
@@ -0,0 +1,71 @@
+/******************************************************************************************
+ * @brief Source file for the BeeRTOS memory footprint report
+ * @file BeeRTOS_footprint.c
+ * This file checks the RAM footprint of the configuration against BEERTOS_RAM_BUDGET at
+ * compile time and provides the report (os_footprint) as a constant, so it can be read from
+ * the object file without running the code (see Tools/footprint_report.py).
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS_footprint.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+#if (BEERTOS_RAM_BUDGET > 0U)
+_Static_assert(OS_FOOTPRINT_RAM_TOTAL <= BEERTOS_RAM_BUDGET,
+               "BeeRTOS kernel objects exceed BEERTOS_RAM_BUDGET, see Tools/footprint_report.py");
+#endif
+
+/*! Entry of objects of the same size */
+#define OS_FOOTPRINT_ENTRY(count, type, masks) \
+    {(count), sizeof(type), (masks) * sizeof(os_task_mask_t), (count) * sizeof(type)}
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        VARIABLES                                       *
+ ******************************************************************************************/
+
+const os_footprint_t os_footprint = {
+    .size = sizeof(os_footprint_t),
+    .ram_total = OS_FOOTPRINT_RAM_TOTAL,
+    .ram_budget = BEERTOS_RAM_BUDGET,
+    .priority_levels = OS_TASK_MAX,
+    .task_mask_bytes = sizeof(os_task_mask_t),
+    .stacks = {OS_FOOTPRINT_TCB_COUNT, 0U, 0U, OS_FOOTPRINT_STACK_BYTES},
+    .tcbs = OS_FOOTPRINT_ENTRY(OS_FOOTPRINT_TCB_COUNT, os_task_t, 0U),
+#if (BEERTOS_USE_TASK_POOL == true)
+    .task_pool = {OS_TASK_POOL_SLOT_COUNT, 0U, 0U, OS_FOOTPRINT_TASK_POOL_BYTES},
+#endif
+    .scheduler = {OS_TASK_MAX, 0U, 2U * sizeof(os_task_mask_t), OS_FOOTPRINT_SCHEDULER_BYTES},
+    .queues = OS_FOOTPRINT_ENTRY(OS_MSG_QUEUE_ID_MAX, os_queue_t, 0U),
+    .queue_buffers = {BEERTOS_QUEUE_ID_MAX, 0U, 0U, OS_FOOTPRINT_QUEUE_BUFFER_BYTES},
+    .messages = OS_FOOTPRINT_ENTRY(OS_MESSAGE_ID_MAX, os_message_t, 2U),
+    .message_buffers = {OS_MESSAGE_ID_MAX, 0U, 0U, OS_FOOTPRINT_MESSAGE_BUFFER_BYTES},
+    .semaphores = OS_FOOTPRINT_ENTRY(BEERTOS_SEMAPHORE_ID_MAX, os_sem_t, 1U),
+    .mutexes = OS_FOOTPRINT_ENTRY(BEERTOS_MUTEX_ID_MAX, os_mutex_t, 0U),
+    .alarms = OS_FOOTPRINT_ENTRY(BEERTOS_ALARM_ID_MAX, os_alarm_t, 0U),
+    .event_groups = OS_FOOTPRINT_ENTRY(BEERTOS_EVENT_GROUP_ID_MAX, os_event_group_t, 1U),
+    .event_waiters = OS_FOOTPRINT_ENTRY(OS_TASK_MAX, os_event_waiter_t, 0U),
+#if (BEERTOS_DEFER_MODULE_EN == true)
+    .defer = OS_FOOTPRINT_ENTRY(BEERTOS_DEFER_QUEUE_SIZE, os_defer_entry_t, 0U),
+#endif
+#if (BEERTOS_WDG_MODULE_EN == true)
+    .wdg = OS_FOOTPRINT_ENTRY(OS_TASK_MAX, os_wdg_entry_t, 0U),
+#endif
+    .trace = {(OS_FOOTPRINT_TRACE_BYTES > 0U) ? 1U : 0U, OS_FOOTPRINT_TRACE_BYTES, 0U, OS_FOOTPRINT_TRACE_BYTES},
+#if (BEERTOS_USE_ASSERT_HISTORY_LOG == true)
+    .assert_log = OS_FOOTPRINT_ENTRY(BEERTOS_ASSERT_HISTORY_LOG_SIZE, os_error_t, 0U),
+#endif
+};
+
+/******************************************************************************************
+ *                                        FUNCTIONS                                       *
+ ******************************************************************************************/
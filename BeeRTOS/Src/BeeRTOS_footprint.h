@@ -0,0 +1,288 @@
+/******************************************************************************************
+ * @brief Header file for the BeeRTOS memory footprint report
+ * @file BeeRTOS_footprint.h
+ * This header file computes the RAM used by the kernel for the current configuration. All the
+ * kernel objects are allocated statically from the lists in BeeRTOS_cfg.h, so the footprint is
+ * known at compile time - the OS_FOOTPRINT_* macros are constant expressions, which can be used
+ * in static assertions or array sizes. BeeRTOS_footprint.c checks the total against
+ * BEERTOS_RAM_BUDGET and stores the report in os_footprint, which Tools/footprint_report.py
+ * reads from the compiled object file. Alignment padding between the objects is not included.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_FOOTPRINT_H__
+#define __BEERTOS_FOOTPRINT_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#include "BeeRTOS_assert.h"
+#include "BeeRTOS_trace_cfg.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/*! Task stacks, including the idle task, the shared stack of basic tasks and the MPU guards */
+#define OS_FOOTPRINT_STACK_BYTES (sizeof(os_footprint_stacks_t))
+/*! Task control blocks, including the idle task */
+#define OS_FOOTPRINT_TCB_COUNT (sizeof(os_footprint_tcbs_t) / sizeof(os_task_t))
+#define OS_FOOTPRINT_TCB_BYTES (sizeof(os_footprint_tcbs_t))
+
+/*! Task pool - stacks and slots of all stack classes and the free lists */
+#if (BEERTOS_USE_TASK_POOL == true)
+#define OS_FOOTPRINT_TASK_POOL_BYTES                                         \
+    ((sizeof(os_footprint_pool_stacks_t) - 1U) +                             \
+     (OS_TASK_POOL_SLOT_COUNT * sizeof(os_task_pool_slot_t)) +               \
+     (OS_STACK_CLASS_MAX * sizeof(os_task_pool_slot_t *)))
+#else
+#define OS_FOOTPRINT_TASK_POOL_BYTES (0U)
+#endif
+
+/*! Scheduler tables indexed by the task ID (os_tasks, os_task_stacks), the ready and delay
+ *  masks and the per-task tables of the enabled options */
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+#define OS_FOOTPRINT_RR_BYTES (3U * OS_TASK_MAX * sizeof(os_task_prio_t))
+#else
+#define OS_FOOTPRINT_RR_BYTES (0U)
+#endif
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+#define OS_FOOTPRINT_HIGH_WATER_BYTES (OS_TASK_MAX * sizeof(uint32_t))
+#else
+#define OS_FOOTPRINT_HIGH_WATER_BYTES (0U)
+#endif
+#if (BEERTOS_USE_EDF == true)
+#define OS_FOOTPRINT_EDF_BYTES (OS_EDF_TASK_COUNT * sizeof(os_task_t *))
+#else
+#define OS_FOOTPRINT_EDF_BYTES (0U)
+#endif
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+#define OS_FOOTPRINT_PERIODIC_BYTES                                          \
+    ((OS_PERIODIC_TASK_COUNT * sizeof(os_task_periodic_t)) +                 \
+     (OS_TASK_MAX * sizeof(os_task_periodic_t *)))
+#else
+#define OS_FOOTPRINT_PERIODIC_BYTES (0U)
+#endif
+#define OS_FOOTPRINT_SCHEDULER_BYTES                                         \
+    ((OS_TASK_MAX * (sizeof(os_task_t *) + sizeof(os_stack_t *))) +          \
+     (2U * sizeof(os_task_mask_t)) + OS_FOOTPRINT_RR_BYTES +                 \
+     OS_FOOTPRINT_HIGH_WATER_BYTES + OS_FOOTPRINT_EDF_BYTES +                \
+     OS_FOOTPRINT_PERIODIC_BYTES)
+
+/*! Queues - the queue table holds the queues and the queues of the messages */
+#define OS_FOOTPRINT_QUEUE_BYTES (OS_MSG_QUEUE_ID_MAX * sizeof(os_queue_t))
+#define OS_FOOTPRINT_QUEUE_BUFFER_BYTES (sizeof(os_footprint_queue_buffers_t) - 1U)
+#define OS_FOOTPRINT_MESSAGE_BYTES (OS_MESSAGE_ID_MAX * sizeof(os_message_t))
+#define OS_FOOTPRINT_MESSAGE_BUFFER_BYTES (sizeof(os_footprint_message_buffers_t) - 1U)
+
+/*! Synchronization objects */
+#define OS_FOOTPRINT_SEMAPHORE_BYTES (BEERTOS_SEMAPHORE_ID_MAX * sizeof(os_sem_t))
+#define OS_FOOTPRINT_MUTEX_BYTES (BEERTOS_MUTEX_ID_MAX * sizeof(os_mutex_t))
+#define OS_FOOTPRINT_ALARM_BYTES (BEERTOS_ALARM_ID_MAX * sizeof(os_alarm_t))
+#define OS_FOOTPRINT_EVENT_GROUP_BYTES (BEERTOS_EVENT_GROUP_ID_MAX * sizeof(os_event_group_t))
+#define OS_FOOTPRINT_EVENT_WAITER_BYTES (OS_TASK_MAX * sizeof(os_event_waiter_t))
+#if (BEERTOS_DEFER_MODULE_EN == true)
+#define OS_FOOTPRINT_DEFER_BYTES (BEERTOS_DEFER_QUEUE_SIZE * sizeof(os_defer_entry_t))
+#else
+#define OS_FOOTPRINT_DEFER_BYTES (0U)
+#endif
+#if (BEERTOS_WDG_MODULE_EN == true)
+#define OS_FOOTPRINT_WDG_BYTES (OS_TASK_MAX * sizeof(os_wdg_entry_t))
+#else
+#define OS_FOOTPRINT_WDG_BYTES (0U)
+#endif
+
+/*! Diagnostics */
+#if (BEERTOS_USE_TRACE_RECORDER == true)
+#define OS_FOOTPRINT_TRACE_BYTES (sizeof(os_trace_buffer_t))
+#else
+#define OS_FOOTPRINT_TRACE_BYTES (0U)
+#endif
+#if (BEERTOS_USE_ASSERT_HISTORY_LOG == true)
+#define OS_FOOTPRINT_ASSERT_LOG_BYTES (BEERTOS_ASSERT_HISTORY_LOG_SIZE * sizeof(os_error_t))
+#else
+#define OS_FOOTPRINT_ASSERT_LOG_BYTES (0U)
+#endif
+
+/*! Total RAM of the kernel objects */
+#define OS_FOOTPRINT_RAM_TOTAL                                                                     \
+    (OS_FOOTPRINT_STACK_BYTES + OS_FOOTPRINT_TCB_BYTES + OS_FOOTPRINT_TASK_POOL_BYTES +           \
+     OS_FOOTPRINT_SCHEDULER_BYTES +                                                                \
+     OS_FOOTPRINT_QUEUE_BYTES + OS_FOOTPRINT_QUEUE_BUFFER_BYTES + OS_FOOTPRINT_MESSAGE_BYTES +    \
+     OS_FOOTPRINT_MESSAGE_BUFFER_BYTES + OS_FOOTPRINT_SEMAPHORE_BYTES + OS_FOOTPRINT_MUTEX_BYTES + \
+     OS_FOOTPRINT_ALARM_BYTES + OS_FOOTPRINT_EVENT_GROUP_BYTES + OS_FOOTPRINT_EVENT_WAITER_BYTES + \
+     OS_FOOTPRINT_DEFER_BYTES + OS_FOOTPRINT_WDG_BYTES + OS_FOOTPRINT_TRACE_BYTES +               \
+     OS_FOOTPRINT_ASSERT_LOG_BYTES)
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to mirror the task stacks - the size of the structure is the sum of the stacks */
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_TASK(name, cb, stack, ...) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_ALARM_TASK(name, stack) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_DEFER_TASK(name, stack) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_RR_TASK(name, cb, stack, ...) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_THRESHOLD_TASK(name, cb, stack, ...) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_EDF_TASK(name, cb, stack, ...) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_PERIODIC_TASK(name, cb, stack, ...) \
+    uint8_t name##_stack[(stack) * sizeof(os_stack_t)];
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...)
+
+typedef struct
+{
+    uint8_t os_idle_task_stack[BEERTOS_IDLE_TASK_STACK_SIZE * sizeof(os_stack_t)];
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    uint8_t os_basic_task_stack[BEERTOS_BASIC_TASK_STACK_SIZE * sizeof(os_stack_t)];
+#endif
+    BEERTOS_PRIORITY_LIST()
+} os_footprint_stacks_t;
+
+/******************************************************************************************/
+
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to mirror the task control blocks, mutex slots have none */
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_ALARM_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_DEFER_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_RR_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_THRESHOLD_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_EDF_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_PERIODIC_TASK(name, ...) \
+    os_task_t name##_control;
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(name, ...) \
+    os_task_t name##_control;
+
+typedef struct
+{
+    os_task_t os_idle_task_control;
+    BEERTOS_PRIORITY_LIST()
+} os_footprint_tcbs_t;
+
+/******************************************************************************************/
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/*! X-Macro to mirror the stacks of the task pool, the first byte is not counted */
+#undef OS_STACK_CLASS
+#define OS_STACK_CLASS(name, stack, count) \
+    uint8_t name##_pool_stacks[(count) * (stack) * sizeof(os_stack_t)];
+
+typedef struct
+{
+    uint8_t reserved;
+    BEERTOS_TASK_POOL_LIST()
+} os_footprint_pool_stacks_t;
+#endif
+
+/******************************************************************************************/
+
+/*! X-Macros to mirror the queue and message buffers, the first byte is not counted (the
+ *  lists can be empty) */
+#undef OS_QUEUE
+#define OS_QUEUE(name, size) \
+    uint8_t name##_buffer[size];
+
+typedef struct
+{
+    uint8_t reserved;
+    BEERTOS_QUEUE_LIST()
+} os_footprint_queue_buffers_t;
+
+#undef OS_MESSAGE
+#define OS_MESSAGE(name, count, size) \
+    uint8_t name##_buffer[(count) * (size)];
+
+typedef struct
+{
+    uint8_t reserved;
+    OS_MESSAGES_LIST()
+} os_footprint_message_buffers_t;
+
+/******************************************************************************************/
+
+/*! Footprint of one kind of kernel objects */
+typedef struct
+{
+    uint32_t count;      /* number of objects */
+    uint32_t entry_size; /* bytes per object, 0 if the objects differ in size */
+    uint32_t mask_bytes; /* bytes of task masks per object */
+    uint32_t bytes;      /* total bytes */
+} os_footprint_entry_t;
+
+/*! Footprint report, all the fields are uint32_t, so the host tool can decode it */
+typedef struct
+{
+    uint32_t size;            /* sizeof(os_footprint_t), identifies the byte order */
+    uint32_t ram_total;       /* OS_FOOTPRINT_RAM_TOTAL */
+    uint32_t ram_budget;      /* BEERTOS_RAM_BUDGET, 0 if not checked */
+    uint32_t priority_levels; /* OS_TASK_MAX - tasks, mutexes and the idle task */
+    uint32_t task_mask_bytes; /* sizeof(os_task_mask_t) */
+    os_footprint_entry_t stacks;
+    os_footprint_entry_t tcbs;
+    os_footprint_entry_t task_pool;
+    os_footprint_entry_t scheduler;
+    os_footprint_entry_t queues;
+    os_footprint_entry_t queue_buffers;
+    os_footprint_entry_t messages;
+    os_footprint_entry_t message_buffers;
+    os_footprint_entry_t semaphores;
+    os_footprint_entry_t mutexes;
+    os_footprint_entry_t alarms;
+    os_footprint_entry_t event_groups;
+    os_footprint_entry_t event_waiters;
+    os_footprint_entry_t defer;
+    os_footprint_entry_t wdg;
+    os_footprint_entry_t trace;
+    os_footprint_entry_t assert_log;
+} os_footprint_t;
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/*! Not static, so it can be read by its symbol from the object file or a RAM dump */
+extern const os_footprint_t os_footprint;
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+#endif /* __BEERTOS_FOOTPRINT_H__ */
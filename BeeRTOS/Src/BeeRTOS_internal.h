@@ -12,8 +12,8 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
-#include "os_portable.h"
 #include "BeeRTOS_cfg.h"
+#include "os_portable.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
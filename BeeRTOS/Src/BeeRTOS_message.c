@@ -12,6 +12,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
+#include "BeeRTOS.h"
 #include "BeeRTOS_message.h"
 #include "BeeRTOS_assert.h"
 #include "BeeRTOS_task.h"
@@ -27,15 +28,6 @@
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
 
-/*! Structure describing a message (created using os_queue_t structure) */
-typedef struct
-{
-    os_queue_t *queue;
-    uint32_t item_size;
-    os_task_mask_t send_waiting_tasks;
-    os_task_mask_t receive_waiting_tasks;
-} os_message_t;
-
 /******************************************************************************************
  *                                        VARIABLES                                       *
  ******************************************************************************************/
@@ -53,11 +45,11 @@ static os_message_t os_messages[OS_MESSAGE_ID_MAX];
 
 static void os_message_release_waiting_task(os_task_mask_t *const task_mask)
 {
-    const os_task_id_t highest_prio_task = OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(*task_mask);
+    const os_task_prio_t highest_prio_task = os_task_mask_get_highest(task_mask);
     os_task_t *const task = os_tasks[highest_prio_task];
 
     /* Clear the bit in the mask */
-    *task_mask &= ~(1U << (task->priority - 1U));
+    os_task_mask_clear(task_mask, task->priority);
     /* Release the task */
     os_task_release(OS_GET_TASK_ID_FROM_PRIORITY(task->priority));
     BEERTOS_TRACE_MESSAGE_UNBLOCKED(task);
@@ -66,30 +58,31 @@ static void os_message_release_waiting_task(os_task_mask_t *const task_mask)
 static bool os_message_handle_timeout(os_message_t *msg,
                                       const void *data,
                                       const uint32_t timeout,
-                                      const bool is_send_operation)
+                                      const bool is_send_operation,
+                                      const os_crit_state_t crit_state)
 {
     os_task_mask_t *waiting_tasks = is_send_operation ? &msg->send_waiting_tasks : &msg->receive_waiting_tasks;
     bool (*queue_op)(uint32_t, const void *, uint32_t) = is_send_operation ? os_queue_push : os_queue_pop;
     const uint32_t id = msg - os_messages;
-    const uint8_t current_task_priority = os_task_current->priority;
+    const os_task_prio_t current_task_priority = os_task_current->priority;
 
     /* Mark the task as waiting */
-    *waiting_tasks |= (1U << (current_task_priority - 1U));
+    os_task_mask_set(waiting_tasks, current_task_priority);
 
     os_delay(timeout);
     BEERTOS_TRACE_MESSAGE_BLOCKED(os_task_current);
     /* Scheduler will be called by the delay function, enable interrupts to
        allow possible context switch */
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
-    /* End of the delay, disable interrupts again */
-    os_enter_critical_section();
+    /* End of the delay, disable interrupts again (the state is the same as in the caller) */
+    (void)os_enter_critical_section();
 
     /* Try to perform the operation again */
     bool operation_success = queue_op(id + BEERTOS_QUEUE_ID_MAX, data, msg->item_size);
 
     /* Clear the waiting bit */
-    *waiting_tasks &= ~(1U << (current_task_priority - 1U));
+    os_task_mask_clear(waiting_tasks, current_task_priority);
 
     return operation_success;
 }
@@ -109,7 +102,8 @@ void os_message_module_init(void)
     #define OS_MESSAGE(name, count, size)                                  \
         os_messages[name].queue = &os_queues[name + BEERTOS_QUEUE_ID_MAX]; \
         os_messages[name].item_size = size;                                \
-        os_messages[name].send_waiting_tasks = 0U;
+        os_task_mask_reset(&os_messages[name].send_waiting_tasks);    \
+        os_task_mask_reset(&os_messages[name].receive_waiting_tasks);
 
     #define OS_MESSAGE_INIT_ALL() OS_MESSAGES_LIST()
     OS_MESSAGE_INIT_ALL();
@@ -137,7 +131,7 @@ bool os_message_send(const os_message_id_t id, const void *const data, const uin
     bool msg_sent = false;
     os_message_t *const msg = &os_messages[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if message can be pushed instantly */
     if (true == os_queue_push(id + BEERTOS_QUEUE_ID_MAX, data, msg->item_size))
@@ -145,21 +139,21 @@ bool os_message_send(const os_message_id_t id, const void *const data, const uin
         msg_sent = true;
 
         /* If there are tasks blocked on this message, release the highest priority one */
-        if (msg->receive_waiting_tasks)
+        if (!os_task_mask_is_empty(&msg->receive_waiting_tasks))
         {
             os_message_release_waiting_task(&msg->receive_waiting_tasks);
         }
     }
     else if (0U != timeout)
     {
-        msg_sent = os_message_handle_timeout(msg, data, timeout, true);
+        msg_sent = os_message_handle_timeout(msg, data, timeout, true, crit_state);
     }
     else
     {
         /* Timetout is set to 0, just return false */
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return msg_sent;
 }
@@ -187,7 +181,7 @@ bool os_message_receive(const os_message_id_t id, void *const data, const uint32
 
     os_message_t *const msg = &os_messages[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if message can be popped instantly */
     if (true == os_queue_pop(id + BEERTOS_QUEUE_ID_MAX, data, msg->item_size))
@@ -195,21 +189,67 @@ bool os_message_receive(const os_message_id_t id, void *const data, const uint32
         msg_received = true;
 
         /* If there are tasks blocked on this message, release the highest priority one */
-        if (msg->send_waiting_tasks)
+        if (!os_task_mask_is_empty(&msg->send_waiting_tasks))
         {
             os_message_release_waiting_task(&msg->send_waiting_tasks);
         }
     }
     else if (0U != timeout)
     {
-        msg_received = os_message_handle_timeout(msg, data, timeout, false);
+        msg_received = os_message_handle_timeout(msg, data, timeout, false, crit_state);
     }
     else
     {
         /* Timetout is set to 0, just return false */
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
+
+    return msg_received;
+}
+
+/**
+ * @brief This function sends a message from an interrupt. It never blocks, if the message
+ * queue is full false is returned. The released task is not scheduled here, call
+ * os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param id - message queue id
+ * @param data - pointer to the data to be sent
+ * @param task_woken - optional, set to true if a task with a higher priority than the
+ *                     interrupted task was released
+ * @return true - message sent successfully
+ *         false - message queue is full
+ */
+bool os_message_send_from_isr(const os_message_id_t id, const void *const data, bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const bool msg_sent = os_message_send(id, data, 0U);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
+
+    return msg_sent;
+}
+
+/**
+ * @brief This function receives a message in an interrupt. It never blocks, if the message
+ * queue is empty false is returned. The released task is not scheduled here, call
+ * os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param id - message queue id
+ * @param data - pointer to the data to be received
+ * @param task_woken - optional, set to true if a task with a higher priority than the
+ *                     interrupted task was released
+ * @return true - message received successfully
+ *         false - message queue is empty
+ */
+bool os_message_receive_from_isr(const os_message_id_t id, void *const data, bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const bool msg_received = os_message_receive(id, data, 0U);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
 
     return msg_received;
 }
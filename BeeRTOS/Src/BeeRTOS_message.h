@@ -14,7 +14,9 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
-#include "Beertos_internal.h"
+#include "BeeRTOS_internal.h"
+#include "BeeRTOS_task.h"
+#include "BeeRTOS_queue.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -38,6 +40,15 @@ typedef enum
     OS_MESSAGE_ID_MAX
 } os_message_id_t;
 
+/*! Structure describing a message (created using os_queue_t structure) */
+typedef struct
+{
+    os_queue_t *queue;
+    uint32_t item_size;
+    os_task_mask_t send_waiting_tasks;
+    os_task_mask_t receive_waiting_tasks;
+} os_message_t;
+
 /******************************************************************************************
  *                                    GLOBAL VARIABLES                                    *
  ******************************************************************************************/
@@ -47,6 +58,8 @@ typedef enum
  ******************************************************************************************/
 void os_message_module_init(void);
 bool os_message_send(const os_message_id_t id, const void *const data, const uint32_t timeout);
+bool os_message_send_from_isr(const os_message_id_t id, const void *const data, bool *const task_woken);
 bool os_message_receive(const os_message_id_t id, void *const data, const uint32_t timeout);
+bool os_message_receive_from_isr(const os_message_id_t id, void *const data, bool *const task_woken);
 
 #endif /* __BEERTOS_MESSAGE_H__ */
\ No newline at end of file
@@ -25,16 +25,6 @@
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
 
-/* Structure to hold mutex data */
-typedef struct
-{
-    os_task_t *owner;       /* task that owns the mutex */
-    os_task_t **pcp_task;   /* priority ceiling protocol task */
-    uint8_t locks_nb;       /* number of locks */
-    uint8_t owner_priority; /* original priority of the owner task */
-    uint8_t pcp_priority;   /* priority ceiling protocol priority */
-} os_mutex_t;
-
 /******************************************************************************************
  *                                        VARIABLES                                       *
  ******************************************************************************************/
@@ -60,6 +50,13 @@ void os_mutex_module_init(void)
     #undef BEERTOS_MUTEX
     #undef BEERTOS_TASK
     #undef BEERTOS_ALARM_TASK
+    #undef BEERTOS_RR_TASK
+    #undef BEERTOS_DEFER_TASK
+    #undef BEERTOS_POOL_TASK
+    #undef BEERTOS_BASIC_TASK
+    #undef BEERTOS_THRESHOLD_TASK
+    #undef BEERTOS_EDF_TASK
+    #undef BEERTOS_PERIODIC_TASK
 
     /* Here is the X-Macro to initialize all mutexes, from user configuration */
     #define BEERTOS_MUTEX(name, initial_count)      \
@@ -76,6 +73,24 @@ void os_mutex_module_init(void)
     #define BEERTOS_ALARM_TASK(...) \
         idx--;
 
+    #define BEERTOS_DEFER_TASK(...) \
+        idx--;
+
+    #define BEERTOS_RR_TASK(...) \
+        idx--;
+    #define BEERTOS_THRESHOLD_TASK(...) \
+        idx--;
+    #define BEERTOS_EDF_TASK(...) \
+        idx--;
+    #define BEERTOS_PERIODIC_TASK(...) \
+        idx--;
+
+    #define BEERTOS_POOL_TASK(...) \
+        idx--;
+
+    #define BEERTOS_BASIC_TASK(...) \
+        idx--;
+
     #define OS_MUTEXES_INIT_ALL() BEERTOS_PRIORITY_LIST()
     OS_MUTEXES_INIT_ALL();
 }
@@ -119,7 +134,7 @@ bool os_mutex_lock(const os_mutex_id_t id, const uint32_t timeout)
                    OS_MODULE_ID_MUTEX,
                    OS_ERROR_OVERFLOW);
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if the mutex is available */
     if (mutex->owner == NULL)
@@ -138,7 +153,6 @@ bool os_mutex_lock(const os_mutex_id_t id, const uint32_t timeout)
         os_task_start(OS_GET_TASK_ID_FROM_PRIORITY((*mutex->pcp_task)->priority));
         BEERTOS_TRACE_MUTEX_PRIORITY_INHERITANCE(current_task,
                                                  current_task->priority);
-        os_sched();
     }
     else if (mutex->owner == current_task)
     {
@@ -166,7 +180,7 @@ bool os_mutex_lock(const os_mutex_id_t id, const uint32_t timeout)
         /* Mutex is not available */
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return (mutex->owner == current_task);
 }
@@ -197,7 +211,7 @@ void os_mutex_unlock(const os_mutex_id_t id)
                    OS_MODULE_ID_MUTEX,
                    OS_ERROR_INVALID_OPERATION);
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     if (mutex->locks_nb > 0U)
     {
@@ -211,7 +225,6 @@ void os_mutex_unlock(const os_mutex_id_t id)
             os_task_stop(OS_GET_TASK_ID_FROM_PRIORITY(mutex->pcp_priority));
             BEERTOS_TRACE_MUTEX_PRIORITY_RESTORE(current_task,
                                                  current_task->priority);
-            os_sched();
 
             /* We should check here if there are tasks blocked on the mutex,
                but in the current implementaion only the mutex PCP is supported,
@@ -219,5 +232,5 @@ void os_mutex_unlock(const os_mutex_id_t id)
         }
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 }
\ No newline at end of file
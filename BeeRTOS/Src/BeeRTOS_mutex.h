@@ -14,7 +14,8 @@
 *                                        INCLUDES                                        *
 ******************************************************************************************/
 
-#include "Beertos_internal.h"
+#include "BeeRTOS_internal.h"
+#include "BeeRTOS_task.h"
 
 /******************************************************************************************
 *                                         DEFINES                                        *
@@ -27,10 +28,24 @@
 #undef BEERTOS_MUTEX
 #undef BEERTOS_TASK
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 #define BEERTOS_MUTEX(name, initial_count) name,
 #define BEERTOS_TASK(...)
 #define BEERTOS_ALARM_TASK(...)
+#define BEERTOS_DEFER_TASK(...)
+#define BEERTOS_RR_TASK(...)
+#define BEERTOS_THRESHOLD_TASK(...)
+#define BEERTOS_EDF_TASK(...)
+#define BEERTOS_PERIODIC_TASK(...)
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...)
 
 #define OS_MUTEX_LIST() BEERTOS_PRIORITY_LIST()
 
@@ -42,6 +57,16 @@ typedef enum
     BEERTOS_MUTEX_ID_MAX
 } os_mutex_id_t; 
 
+/* Structure to hold mutex data */
+typedef struct
+{
+    os_task_t *owner;       /* task that owns the mutex */
+    os_task_t **pcp_task;   /* priority ceiling protocol task */
+    uint8_t locks_nb;       /* number of locks */
+    os_task_prio_t owner_priority; /* original priority of the owner task */
+    os_task_prio_t pcp_priority;   /* priority ceiling protocol priority */
+} os_mutex_t;
+
 /******************************************************************************************
 *                                    GLOBAL VARIABLES                                    *
 ******************************************************************************************/
@@ -10,6 +10,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
+#include "BeeRTOS.h"
 #include "BeeRTOS_queue.h"
 #include "BeeRTOS_message.h"
 #include "BeeRTOS_assert.h"
@@ -79,13 +80,13 @@ void os_queue_reset(const os_queue_id_t id)
 
     os_queue_t *const queue = &os_queues[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     queue->head = 0U;
     queue->tail = 0U;
     queue->full = false;
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 }
 
 /**
@@ -154,19 +155,20 @@ bool os_queue_is_empty(const os_queue_id_t id)
 
     const os_queue_t *const queue = &os_queues[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Queue is empty if head and tail are equal and not full */
     const bool is_empty = (!queue->full && (queue->head == queue->tail));
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return is_empty;
 }
 
 /**
  * @brief The function pushes data to a specific queue.
- * It copies the data to the queue's buffer.
+ * It copies the data to the queue's buffer. It never blocks and does not run the scheduler,
+ * so it can be called from an interrupt as well.
  *
  * @param id - queue id
  * @param data - pointer to the data to be pushed
@@ -186,7 +188,7 @@ bool os_queue_push(const os_queue_id_t id, const void *const data, const uint32_
     bool ret = false;
     os_queue_t *const queue = &os_queues[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if the queue can accept the data */
     if (os_queue_can_push(queue, len))
@@ -200,14 +202,15 @@ bool os_queue_push(const os_queue_id_t id, const void *const data, const uint32_
         ret = true;
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return ret;
 }
 
 /**
  * @brief The function pops data from a specific queue.
- * It copies the data from the queue's buffer.
+ * It copies the data from the queue's buffer. It never blocks and does not run the scheduler,
+ * so it can be called from an interrupt as well.
  *
  * @param id - queue id
  * @param data - pointer to the data to be popped
@@ -227,7 +230,7 @@ bool os_queue_pop(const os_queue_id_t id, void *const data, const uint32_t len)
     uint8_t ret = false;
     os_queue_t *const queue = &os_queues[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
     /* Check if the queue can provide the data */
     if (os_queue_can_pop(queue, len))
@@ -241,7 +244,7 @@ bool os_queue_pop(const os_queue_id_t id, void *const data, const uint32_t len)
         ret = true;
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return ret;
 }
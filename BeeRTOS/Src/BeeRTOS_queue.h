@@ -14,7 +14,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
-#include "Beertos_internal.h"
+#include "BeeRTOS_internal.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -12,6 +12,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
+#include "BeeRTOS.h"
 #include "BeeRTOS_semaphore.h"
 #include "BeeRTOS_task.h"
 #include "BeeRTOS_assert.h"
@@ -25,25 +26,6 @@
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
 
-typedef uint8_t os_sem_type_t;
-
-typedef struct
-{
-#if (BEERTOS_SEMAPHORE_COUNTING_USED == true)
-    uint32_t count;
-#else
-    uint8_t count;
-#endif
-
-    os_task_mask_t tasks_blocked; /* one bit represents one task */
-
-/* If counting semaphores are not used, all semaphores are binary */
-#if (BEERTOS_SEMAPHORE_COUNTING_USED == true)
-    os_sem_type_t type;
-#endif
-
-} os_sem_t;
-
 /******************************************************************************************
  *                                        VARIABLES                                       *
  ******************************************************************************************/
@@ -72,17 +54,16 @@ static inline void os_semaphore_init(os_sem_t *const sem,
                    OS_ERROR_INVALID_PARAM);
 
     sem->count = count;
-    sem->tasks_blocked = 0U;
+    os_task_mask_reset(&sem->tasks_blocked);
     sem->type = type;
 }
 
 static void os_sem_unlock_waiting_task(os_sem_t *const sem)
 {
     /* There are tasks blocked on the semaphore, release the highest priority one */
-    const os_task_id_t highest_prio_task = OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(sem->tasks_blocked);
-    os_task_t *const task = os_tasks[highest_prio_task];
+    os_task_t *const task = os_tasks[os_task_mask_get_highest(&sem->tasks_blocked)];
 
-    sem->tasks_blocked &= ~(1U << (task->priority - 1U));
+    os_task_mask_clear(&sem->tasks_blocked, task->priority);
     os_task_release(OS_GET_TASK_ID_FROM_PRIORITY(task->priority));
     BEERTOS_TRACE_SEMAPHORE_UNBLOCKED(task);
 }
@@ -118,9 +99,9 @@ bool os_semaphore_wait(const os_sem_id_t id, const uint32_t timeout)
 
     bool s_got = true;
     os_sem_t *const sem = &semaphores[id];
-    const uint8_t current_task_priority = os_task_current->priority;
+    const os_task_prio_t current_task_priority = os_task_current->priority;
 
-    os_enter_critical_section();
+    os_crit_state_t crit_state = os_enter_critical_section();
 
     if (sem->count > 0U)
     {
@@ -130,18 +111,18 @@ bool os_semaphore_wait(const os_sem_id_t id, const uint32_t timeout)
     else if (0U != timeout)
     {
         /* Block the task and wait for the semaphore */
-        sem->tasks_blocked |= (1U << (current_task_priority - 1U));
+        os_task_mask_set(&sem->tasks_blocked, current_task_priority);
         os_delay(timeout);
         BEERTOS_TRACE_SEMAPHORE_BLOCKED(os_task_current);
 
-        os_leave_critical_section();
+        os_leave_critical_section(crit_state);
         /* Potencial context switch is right here */
-        os_enter_critical_section();
+        crit_state = os_enter_critical_section();
 
         /* Check if the task was unblocked by the semaphore */
-        s_got = (sem->tasks_blocked & (1U << (current_task_priority - 1U))) == 0U;
+        s_got = !os_task_mask_test(&sem->tasks_blocked, current_task_priority);
         /* Clear the waiting bit */
-        sem->tasks_blocked &= ~(1U << (current_task_priority - 1U));
+        os_task_mask_clear(&sem->tasks_blocked, current_task_priority);
     }
     else
     {
@@ -149,7 +130,7 @@ bool os_semaphore_wait(const os_sem_id_t id, const uint32_t timeout)
         s_got = false;
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
 
     return s_got;
 }
@@ -170,9 +151,9 @@ bool os_semaphore_signal(const os_sem_id_t id)
     bool s_signaled = true;
     os_sem_t *const sem = &semaphores[id];
 
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
 
-    if (sem->tasks_blocked > 0U)
+    if (!os_task_mask_is_empty(&sem->tasks_blocked))
     {
         os_sem_unlock_waiting_task(sem);
     }
@@ -195,7 +176,28 @@ bool os_semaphore_signal(const os_sem_id_t id)
         }
     }
 
-    os_leave_critical_section();
+    os_leave_critical_section(crit_state);
+
+    return s_signaled;
+}
+
+/**
+ * @brief Signal semaphore from an interrupt, never blocks. The released task is not
+ * scheduled here, call os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param id - semaphore id
+ * @param task_woken - optional, set to true if a task with a higher priority than the
+ *                     interrupted task was released
+ *
+ * @return true if semaphore was signaled, false otherwise
+ */
+bool os_semaphore_signal_from_isr(const os_sem_id_t id, bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const bool s_signaled = os_semaphore_signal(id);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
 
     return s_signaled;
-}
\ No newline at end of file
+}
@@ -16,7 +16,8 @@
 *                                        INCLUDES                                        *
 ******************************************************************************************/
 
-#include "Beertos_internal.h"
+#include "BeeRTOS_internal.h"
+#include "BeeRTOS_task.h"
 
 /******************************************************************************************
 *                                         DEFINES                                        *
@@ -51,6 +52,25 @@ typedef enum
 #define BEERTOS_SEMAPHORE_COUNTING_USED     (false)
 #endif
 
+typedef uint8_t os_sem_type_t;
+
+typedef struct
+{
+#if (BEERTOS_SEMAPHORE_COUNTING_USED == true)
+    uint32_t count;
+#else
+    uint8_t count;
+#endif
+
+    os_task_mask_t tasks_blocked; /* one bit represents one task */
+
+/* If counting semaphores are not used, all semaphores are binary */
+#if (BEERTOS_SEMAPHORE_COUNTING_USED == true)
+    os_sem_type_t type;
+#endif
+
+} os_sem_t;
+
 
 /******************************************************************************************
 *                                    GLOBAL VARIABLES                                    *
@@ -62,5 +82,6 @@ typedef enum
 void os_semaphore_module_init(void);
 bool os_semaphore_wait(const os_sem_id_t id, const uint32_t timeout);
 bool os_semaphore_signal(const os_sem_id_t id);
+bool os_semaphore_signal_from_isr(const os_sem_id_t id, bool *const task_woken);
 
 #endif /* __BEERTOS_SEMAPHORE_H__ */
\ No newline at end of file
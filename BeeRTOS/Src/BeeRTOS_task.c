@@ -12,6 +12,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
+#include "BeeRTOS.h"
 #include "BeeRTOS_task.h"
 #include "BeeRTOS_assert.h"
 #include "BeeRTOS_trace_cfg.h"
@@ -20,14 +21,62 @@
  *                                         DEFINES                                        *
  ******************************************************************************************/
 
-#define BIT_SET(var, bit) (var |= (1U << bit))
-#define BIT_CLEAR(var, bit) (var &= ~(1U << bit))
-
-#define BEERTOS_TASK_START(task_id) (BIT_SET(os_ready_mask, (task_id - 1U)))
-#define BEERTOS_TASK_STOP(task_id) (BIT_CLEAR(os_ready_mask, (task_id - 1U)))
-
-#define BEERTOS_TASK_DELAY_SET(task_id) (BIT_SET(os_delay_mask, (task_id - 1U)))
-#define BEERTOS_TASK_DELAY_CLEAR(task_id) (BIT_CLEAR(os_delay_mask, (task_id - 1U)))
+/* Any change of the ready mask requests the scheduler */
+#if (BEERTOS_USE_EDF == true)
+/* Tasks of the EDF group are also kept in the deadline heap while they are ready */
+#define BEERTOS_TASK_START(priority) (os_task_edf_start(priority), os_task_mask_set(&os_ready_mask, (priority)), os_sched_pending = true)
+#define BEERTOS_TASK_STOP(priority) (os_task_edf_stop(priority), os_task_mask_clear(&os_ready_mask, (priority)), os_sched_pending = true)
+#else
+#define BEERTOS_TASK_START(priority) (os_task_mask_set(&os_ready_mask, (priority)), os_sched_pending = true)
+#define BEERTOS_TASK_STOP(priority) (os_task_mask_clear(&os_ready_mask, (priority)), os_sched_pending = true)
+#endif
+
+#define BEERTOS_TASK_DELAY_SET(priority) (os_task_mask_set(&os_delay_mask, (priority)))
+#define BEERTOS_TASK_DELAY_CLEAR(priority) (os_task_mask_clear(&os_delay_mask, (priority)))
+
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+/* Notification states of the task */
+#define OS_TASK_NOTIFY_STATE_NONE       (0U)  /* no notification pending */
+#define OS_TASK_NOTIFY_STATE_WAITING    (1U)  /* task is blocked in os_task_notify_wait */
+#define OS_TASK_NOTIFY_STATE_PENDING    (2U)  /* notification received, not taken yet */
+#endif
+
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+#define OS_TASK_RR_GROUP_JOIN(priority, group) os_task_rr_group_join(priority, group)
+#else
+#define OS_TASK_RR_GROUP_JOIN(priority, group)
+#endif
+
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+#define OS_TASK_THRESHOLD_SET(priority, threshold) os_task_threshold_set(priority, threshold)
+#else
+#define OS_TASK_THRESHOLD_SET(priority, threshold)
+#endif
+
+#if (BEERTOS_USE_EDF == true)
+#define OS_TASK_EDF_JOIN(priority, deadline) os_task_edf_join(priority, deadline)
+#else
+#define OS_TASK_EDF_JOIN(priority, deadline)
+#endif
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+#define OS_TASK_LATENCY_RELEASE(priority) os_task_latency_release(priority)
+#else
+#define OS_TASK_LATENCY_RELEASE(priority)
+#endif
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/* States of a basic task */
+#define OS_TASK_BASIC_SUSPENDED         (0U)  /* not activated */
+#define OS_TASK_BASIC_ACTIVATED         (1U)  /* activated, not dispatched yet - no stack */
+#define OS_TASK_BASIC_RUNNING           (2U)  /* dispatched, uses a part of the shared stack */
+
+/* Basic tasks run to completion on the shared stack, they must never block */
+#define OS_TASK_ASSERT_CAN_BLOCK() \
+    BEERTOS_ASSERT(NULL == os_task_current->basic, OS_MODULE_ID_TASK, OS_ERROR_INVALID_OPERATION)
+#else
+#define OS_TASK_ASSERT_CAN_BLOCK()
+#endif
 
 /******************************************************************************************
  *                                        TYPEDEFS                                        *
@@ -40,25 +89,56 @@
 #undef BEERTOS_TASK
 #undef BEERTOS_MUTEX
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 /*! X-Macro to create task stack array for all tasks and alarm tasks */
 #define BEERTOS_MUTEX(...)
 #define BEERTOS_TASK(name, cb, stack, autostart, argv) \
-    static os_stack_t name##_stack[stack];
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
 #define BEERTOS_ALARM_TASK(name, stack) \
-    static os_stack_t name##_stack[stack];
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_DEFER_TASK(name, stack) \
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_RR_TASK(name, cb, stack, autostart, argv, group) \
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_THRESHOLD_TASK(name, cb, stack, autostart, argv, threshold) \
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_EDF_TASK(name, cb, stack, autostart, argv, deadline) \
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_PERIODIC_TASK(name, cb, stack, period, offset, deadline) \
+    static os_stack_t name##_stack[stack] OS_TASK_STACK_ALIGNED;
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...)
 
 /* This macro creates the stack arrays for all tasks */
 #define OS_CREATE_STACK_VAR() BEERTOS_PRIORITY_LIST()
 
-static os_stack_t os_idle_task_stack[BEERTOS_IDLE_TASK_STACK_SIZE];
+static os_stack_t os_idle_task_stack[BEERTOS_IDLE_TASK_STACK_SIZE] OS_TASK_STACK_ALIGNED;
 OS_CREATE_STACK_VAR();
 
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/*! Stack shared by all basic tasks, the MPU guard (if used) is its lowest part */
+static os_stack_t os_basic_task_stack[BEERTOS_BASIC_TASK_STACK_SIZE] OS_TASK_STACK_ALIGNED;
+#endif
+
 /******************************************************************************************/
 
 #undef BEERTOS_TASK
 #undef BEERTOS_MUTEX
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 /*! X-Macro to create array of pointers to stack arrays for all tasks */
 #define BEERTOS_MUTEX(...) \
@@ -67,6 +147,20 @@ OS_CREATE_STACK_VAR();
     name##_stack,
 #define BEERTOS_ALARM_TASK(name, stack) \
     name##_stack,
+#define BEERTOS_DEFER_TASK(name, stack) \
+    name##_stack,
+#define BEERTOS_RR_TASK(name, ...) \
+    name##_stack,
+#define BEERTOS_THRESHOLD_TASK(name, ...) \
+    name##_stack,
+#define BEERTOS_EDF_TASK(name, ...) \
+    name##_stack,
+#define BEERTOS_PERIODIC_TASK(name, ...) \
+    name##_stack,
+#define BEERTOS_POOL_TASK(...) \
+    NULL,
+#define BEERTOS_BASIC_TASK(...) \
+    os_basic_task_stack,
 
 /* This macro creates the array of pointers to stack arrays for all tasks */
 #define OS_CREATE_STACK_ARRAY() BEERTOS_PRIORITY_LIST()
@@ -79,9 +173,67 @@ static os_stack_t *os_task_stacks[] =
 
 /******************************************************************************************/
 
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to create array of stack sizes in bytes for all tasks, without the MPU guard */
+#define BEERTOS_MUTEX(...) \
+    0U,
+#define BEERTOS_TASK(name, ...) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_ALARM_TASK(name, stack) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_RR_TASK(name, ...) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_THRESHOLD_TASK(name, ...) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_EDF_TASK(name, ...) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_PERIODIC_TASK(name, ...) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_DEFER_TASK(name, stack) \
+    (sizeof(name##_stack) - OS_TASK_STACK_GUARD_SIZE),
+#define BEERTOS_POOL_TASK(...) \
+    0U,
+#define BEERTOS_BASIC_TASK(...) \
+    0U,
+
+/* This macro creates the array of stack sizes for all tasks */
+#define OS_CREATE_STACK_SIZE_ARRAY() BEERTOS_PRIORITY_LIST()
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/* Sizes of the pool priority levels change when a dynamic task is created or deleted */
+static uint32_t os_task_stack_sizes[] =
+#else
+static const uint32_t os_task_stack_sizes[] =
+#endif
+{
+    (sizeof(os_idle_task_stack) - OS_TASK_STACK_GUARD_SIZE),
+    OS_CREATE_STACK_SIZE_ARRAY()
+};
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
+
+/******************************************************************************************/
+
 #undef BEERTOS_TASK
 #undef BEERTOS_MUTEX
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 /*! X-Macro to create task control structure for all tasks */
 #define BEERTOS_MUTEX(...)
@@ -89,6 +241,31 @@ static os_stack_t *os_task_stacks[] =
     static os_task_t name##_control;
 #define BEERTOS_ALARM_TASK(name, ...) \
     static os_task_t name##_control;
+#define BEERTOS_DEFER_TASK(name, ...) \
+    static os_task_t name##_control;
+#define BEERTOS_RR_TASK(name, ...) \
+    static os_task_t name##_control;
+#define BEERTOS_THRESHOLD_TASK(name, cb, stack, autostart, argv, threshold)              \
+    _Static_assert((threshold) <= (name),                                                \
+                   "The preemption threshold of " #name " is below its priority");       \
+    static os_task_t name##_control;
+#define BEERTOS_EDF_TASK(name, ...) \
+    static os_task_t name##_control;
+#define BEERTOS_PERIODIC_TASK(name, cb, stack, task_period, task_offset, task_deadline)  \
+    _Static_assert(((task_period) > 0U) && ((task_deadline) > 0U),                       \
+                   "The period and the deadline of " #name " must be above 0");          \
+    static os_task_t name##_control;                                                     \
+    static os_task_periodic_t name##_periodic = {.handler = (cb),                        \
+                                                 .period = (task_period),                \
+                                                 .offset = (task_offset),                \
+                                                 .deadline = (task_deadline),            \
+                                                 .id = (name)};
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(name, cb, stack, autostart, argv)                   \
+    _Static_assert(((stack) + OS_TASK_STACK_GUARD_WORDS) <= BEERTOS_BASIC_TASK_STACK_SIZE, \
+                   "The stack of " #name " does not fit into the shared stack"); \
+    static os_task_t name##_control;                                           \
+    static const os_task_basic_cfg_t name##_basic = {cb, argv, (stack) * sizeof(os_stack_t), name};
 
 /* This macro creates the task control structure for all tasks */
 #define OS_CREATE_TASK_CONTROL_BLOCK() BEERTOS_PRIORITY_LIST()
@@ -98,6 +275,129 @@ OS_CREATE_TASK_CONTROL_BLOCK();
 
 /******************************************************************************************/
 
+#if (BEERTOS_USE_BASIC_TASKS == true)
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to create the list of basic tasks */
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_TASK(...)
+#define BEERTOS_ALARM_TASK(...)
+#define BEERTOS_DEFER_TASK(...)
+#define BEERTOS_RR_TASK(...)
+#define BEERTOS_THRESHOLD_TASK(...)
+#define BEERTOS_EDF_TASK(...)
+#define BEERTOS_PERIODIC_TASK(...)
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(name, ...) \
+    &name##_control,
+
+/*! Basic tasks, terminated by NULL */
+static os_task_t *const os_basic_tasks[] =
+{
+    BEERTOS_PRIORITY_LIST()
+    NULL
+};
+#endif /* BEERTOS_USE_BASIC_TASKS */
+
+/******************************************************************************************/
+
+#if (BEERTOS_USE_TASK_POOL == true)
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to create array of the names of pool priority levels, NULL for other tasks */
+#define BEERTOS_MUTEX(...) NULL,
+#define BEERTOS_TASK(...) NULL,
+#define BEERTOS_ALARM_TASK(...) NULL,
+#define BEERTOS_DEFER_TASK(...) NULL,
+#define BEERTOS_RR_TASK(...) NULL,
+#define BEERTOS_THRESHOLD_TASK(...) NULL,
+#define BEERTOS_EDF_TASK(...) NULL,
+#define BEERTOS_PERIODIC_TASK(...) NULL,
+#define BEERTOS_POOL_TASK(name) #name,
+#define BEERTOS_BASIC_TASK(...) NULL,
+
+static const char *const os_task_pool_names[] =
+{
+    NULL,
+    BEERTOS_PRIORITY_LIST()
+};
+
+/*! Only the first slot of a stack class is aligned, the next slots keep the alignment of the
+    MPU guard if the stack size is its multiple */
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+#define OS_STACK_CLASS_GUARD_CHECK(name, stack)                                         \
+    _Static_assert((((stack) * sizeof(os_stack_t)) % OS_TASK_STACK_GUARD_SIZE) == 0U,   \
+                   "The stack size of " #name " is not a multiple of the MPU guard size");
+#else
+#define OS_STACK_CLASS_GUARD_CHECK(name, stack)
+#endif
+
+/*! X-Macro to create the stacks and slots of all stack classes */
+#undef OS_STACK_CLASS
+#define OS_STACK_CLASS(name, stack, count)                                 \
+    OS_STACK_CLASS_GUARD_CHECK(name, stack)                                \
+    static os_stack_t name##_pool_stacks[count][stack] OS_TASK_STACK_ALIGNED; \
+    static os_task_pool_slot_t name##_pool_slots[count];
+
+BEERTOS_TASK_POOL_LIST()
+
+/*! Free slots of each stack class, linked by next_free */
+static os_task_pool_slot_t *os_task_pool_free[OS_STACK_CLASS_MAX];
+#endif /* BEERTOS_USE_TASK_POOL */
+
+/******************************************************************************************/
+
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+/*! X-Macro to create array of the periodic task data indexed by the task id, NULL for other tasks */
+#define BEERTOS_MUTEX(...) NULL,
+#define BEERTOS_TASK(...) NULL,
+#define BEERTOS_ALARM_TASK(...) NULL,
+#define BEERTOS_DEFER_TASK(...) NULL,
+#define BEERTOS_RR_TASK(...) NULL,
+#define BEERTOS_THRESHOLD_TASK(...) NULL,
+#define BEERTOS_EDF_TASK(...) NULL,
+#define BEERTOS_PERIODIC_TASK(name, ...) &name##_periodic,
+#define BEERTOS_POOL_TASK(...) NULL,
+#define BEERTOS_BASIC_TASK(...) NULL,
+
+static os_task_periodic_t *const os_task_periodic[] =
+{
+    NULL,
+    BEERTOS_PRIORITY_LIST()
+};
+#endif /* BEERTOS_USE_PERIODIC_TASKS */
+
+/******************************************************************************************/
+
 /*! Pointer to the current task */
 os_task_t *volatile os_task_current;
 
@@ -107,29 +407,111 @@ os_task_t *volatile os_task_next;
 /*! Array of pointers to task control structures, the index is the priority of the task */
 os_task_t *os_tasks[OS_TASK_MAX];
 
+/*! Set when the scheduler has to be run, the scheduler is run once when
+ *  the outermost critical section is left (see os_leave_critical_section) */
+volatile bool os_sched_pending;
+
 /*! Mask of ready tasks */
 static os_task_mask_t os_ready_mask;
 /*! Mask of delayed tasks */
 static os_task_mask_t os_delay_mask;
 
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+/*! Members of a round-robin group have consecutive priorities. Highest and lowest
+ *  priority of the group of the task, indexed by priority, 0 if the task does not
+ *  belong to any group */
+static os_task_prio_t os_rr_group_top[OS_TASK_MAX];
+static os_task_prio_t os_rr_group_low[OS_TASK_MAX];
+/*! Priority of the group member to be scheduled next, indexed by the highest
+ *  priority in the group */
+static os_task_prio_t os_rr_next[OS_TASK_MAX];
+/*! Ticks left from the time slice of the current task */
+static uint32_t os_rr_quantum;
+#endif
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+/*! Free stack bytes found by the last scan of each task, indexed by the task id */
+static uint32_t os_task_stack_free[OS_TASK_MAX];
+/*! Position of the incremental stack scan run by the idle task */
+static uint32_t os_task_stack_scan_id;
+static uint32_t os_task_stack_scan_word;
+#endif
+
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+/*! Task the CPU time is accounted to and the timestamp when it was switched in */
+static os_task_t *os_runtime_task;
+static uint32_t os_runtime_timestamp;
+/*! CPU time of all tasks, and the total and idle time at the last os_get_cpu_load() call */
+static uint64_t os_runtime_total;
+static uint64_t os_runtime_load_total;
+static uint64_t os_runtime_load_idle;
+#endif
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+/*! Interrupt nesting level and the timestamp of the outermost interrupt entry */
+static uint32_t os_isr_nesting;
+static uint32_t os_isr_timestamp;
+#endif
+
+#if (BEERTOS_USE_DELAY_LIST == true)
+/*! Delta list of delayed tasks ordered by wakeup time, ticks of each task are relative
+ *  to the previous task in the list, so only the head is updated on each tick */
+static os_task_t *os_delay_list;
+#endif
+
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+/*! Last dispatched threshold task which did not block yet, linked by threshold_prev */
+static os_task_t *os_threshold_top;
+#endif
+
+#if (BEERTOS_USE_EDF == true)
+/*! Ready tasks of the EDF group, a binary min-heap ordered by the absolute deadline */
+static os_task_t *os_edf_heap[(OS_EDF_TASK_COUNT > 0U) ? OS_EDF_TASK_COUNT : 1U];
+static uint32_t os_edf_heap_size;
+/*! Priority levels of the EDF group, empty if os_edf_top < os_edf_low */
+static os_task_prio_t os_edf_top;
+static os_task_prio_t os_edf_low;
+#endif
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/*! Basic task whose function returned, until it is switched out - it still runs on its stack */
+static os_task_t *os_basic_task_completed;
+/*! Most bytes of the shared stack used by dispatched basic tasks at the same time */
+static uint32_t os_basic_task_stack_peak;
+#endif
+
 /******************************************************************************************
  *                                        FUNCTIONS                                       *
  ******************************************************************************************/
 
 extern os_stack_t *os_port_task_stack_init(void (*task)(void *), void *arg, void *stack_ptr, uint32_t stack_size);
 extern void os_port_context_switch(void);
+#if (BEERTOS_USE_BASIC_TASKS == true)
+extern void os_context_switched_cb(void);
+#endif
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+extern void os_tickless_idle(void);
+#endif
 
 #if (BEERTOS_USE_TASK_STACK_MONITOR == true)
+/* Returns the stack of the priority level the task runs at (os_task_stacks is indexed by the task id,
+   the idle task is the first one). NULL while the task holds a mutex - the priority ceiling slot has no stack */
+static inline const os_stack_t *os_task_stack_mon_base(const os_task_t *const task)
+{
+    return os_task_stacks[(0U == task->priority) ? OS_TASK_IDLE : OS_GET_TASK_ID_FROM_PRIORITY(task->priority)];
+}
+
 #if (BEERTOS_USE_FAST_STACK_MONITOR == true)
 static inline void os_task_stack_mon(void)
 {
-    const os_task_t *const task = os_task_current;
+    const os_stack_t *const stack = os_task_stack_mon_base(os_task_current);
     const os_stack_t pattern = OS_TASK_STACK_PATTERN;
 
-    if ((os_task_stacks[OS_GET_TASK_ID_FROM_PRIORITY(task->priority)][0] != pattern) ||
-        (os_task_stacks[OS_GET_TASK_ID_FROM_PRIORITY(task->priority)][1] != pattern) ||
-        (os_task_stacks[OS_GET_TASK_ID_FROM_PRIORITY(task->priority)][2] != pattern) ||
-        (os_task_stacks[OS_GET_TASK_ID_FROM_PRIORITY(task->priority)][3] != pattern))
+    if ((NULL != stack) &&
+        ((stack[0] != pattern) ||
+         (stack[1] != pattern) ||
+         (stack[2] != pattern) ||
+         (stack[3] != pattern)))
     {
         /* TODO - handle stack overflow */
         // while (1)
@@ -139,12 +521,12 @@ static inline void os_task_stack_mon(void)
 #elif (BEERTOS_USE_USER_STACK_MONITOR == true)
 static inline void os_task_stack_mon(void)
 {
-    const os_task_t *const task = os_task_current;
+    const os_stack_t *const stack = os_task_stack_mon_base(os_task_current);
     const os_stack_t pattern = OS_TASK_STACK_PATTERN;
 
-    for (uint32_t i = 0U; i < OS_TASK_STACK_CHECK_BYTE_COUNT; i++)
+    for (uint32_t i = 0U; (NULL != stack) && (i < OS_TASK_STACK_CHECK_BYTE_COUNT); i++)
     {
-        if (os_task_stacks[task->priority][i] != pattern)
+        if (stack[i] != pattern)
         {
             /* TODO - handle stack overflow */
             while (1)
@@ -155,267 +537,1961 @@ static inline void os_task_stack_mon(void)
 #endif /* BEERTOS_USE_USER_STACK_MONITOR */
 #endif /* BEERTOS_USE_TASK_STACK_MONITOR */
 
-static void os_task_create(os_task_t *const task,
-                           const os_task_handler task_handler,
-                           void *const stack,
-                           const uint32_t stack_size,
-                           const uint8_t priority,
-                           const void *const argv)
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+/**
+ * @brief Scan the next BEERTOS_STACK_HIGH_WATER_SCAN_WORDS words of the stack of one task.
+ * The stack grows down, so the pattern is counted from the stack base (above the MPU guard)
+ * up to the first used word. When the scan of a task is finished, the next task is scanned. Called by the idle task.
+ */
+static void os_task_stack_scan_step(void)
 {
-    BEERTOS_ASSERT(os_tasks[priority] == NULL, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-    BEERTOS_ASSERT(task != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
-    BEERTOS_ASSERT(task_handler != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
-    BEERTOS_ASSERT(stack != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
-    BEERTOS_ASSERT(priority < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-
-    os_stack_t *stack_ptr = os_port_task_stack_init(task_handler, argv, stack, stack_size);
-
-    /* Set stack pointer */
-    task->sp = (void *)stack_ptr;
-    task->priority = priority;
-    task->ticks = 0U;
-
-    os_tasks[priority] = task;
-}
+#if (BEERTOS_USE_TASK_POOL == true)
+    /* The stack of a pool priority level changes when a dynamic task is created */
+    const os_crit_state_t crit_state = os_enter_critical_section();
+#endif
+    const os_stack_t *const stack = os_task_stacks[os_task_stack_scan_id];
+    const uint32_t words = os_task_stack_sizes[os_task_stack_scan_id] / sizeof(os_stack_t);
+#if (BEERTOS_USE_TASK_POOL == true)
+    os_leave_critical_section(crit_state);
+#endif
+    uint32_t end = os_task_stack_scan_word + BEERTOS_STACK_HIGH_WATER_SCAN_WORDS;
+
+    if (end > words)
+    {
+        end = words;
+    }
 
-static void os_idle_task(void *argv)
-{
-    BEERTOS_IDLE_TASK_INIT_CB();
+    while ((os_task_stack_scan_word < end) &&
+           (stack[OS_TASK_STACK_GUARD_WORDS + os_task_stack_scan_word] == OS_TASK_STACK_PATTERN))
+    {
+        os_task_stack_scan_word++;
+    }
 
-    while (1)
+    /* Used word found or the whole stack is free (mutex slots have no stack) */
+    if ((os_task_stack_scan_word < end) || (end == words))
     {
-        BEERTOS_IDLE_TASK_CB();
+        os_task_stack_free[os_task_stack_scan_id] = os_task_stack_scan_word * sizeof(os_stack_t);
+        os_task_stack_scan_id = (os_task_stack_scan_id + 1U) % OS_TASK_MAX;
+        os_task_stack_scan_word = 0U;
     }
 }
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
 
-static void os_tasks_init(void)
+#if (BEERTOS_USE_DELAY_LIST == true)
+/**
+ * @brief Insert the task into the delta list of delayed tasks.
+ * Tasks with the same wakeup time are woken up in the order of insertion.
+ *
+ * @param task - task to be delayed
+ * @param ticks - number of ticks to delay
+ * @return None
+ */
+static inline void os_task_delay_insert(os_task_t *const task, uint32_t ticks)
 {
-    /* Start from the max priority, since BEERTOS_PRIORITY_LIST 
-       is defined from the highest priority to the lowest */
-    uint8_t priority = OS_TASK_MAX - 1U;
+    os_task_t *prev = NULL;
+    os_task_t *next = os_delay_list;
 
-    #undef BEERTOS_TASK
-    #undef BEERTOS_MUTEX
-    #undef BEERTOS_ALARM_TASK
+    /* Delay of 0 ticks expires on the next tick, same as in the per-tick scan */
+    if (0U == ticks)
+    {
+        ticks = 1U;
+    }
 
-    /* X-Macro to call os_task_create for all tasks */
-    #define BEERTOS_TASK(name, cb, stack, autostart, argv)          \
-        os_task_create(&name##_control, cb, name##_stack,           \
-                       sizeof(name##_stack), priority, argv);       \
-        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);   \
-        priority--;
+    /* Find the position, converting the delay to a delta relative to the previous task */
+    while ((next != NULL) && (next->ticks <= ticks))
+    {
+        ticks -= next->ticks;
+        prev = next;
+        next = next->delay_next;
+    }
 
-    #define BEERTOS_ALARM_TASK(name, stack)                          \
-        os_task_create(&name##_control, os_alarm_task, name##_stack, \
-                       sizeof(name##_stack), priority, NULL);        \
-        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);    \
-        priority--;
+    task->ticks = ticks;
+    task->delay_prev = prev;
+    task->delay_next = next;
 
-    #define BEERTOS_MUTEX(name, ...)   \
-        os_tasks[priority] = NULL;     \
-        priority--;
+    if (next != NULL)
+    {
+        next->ticks -= ticks;
+        next->delay_prev = task;
+    }
 
-    /* This macro calls os_task_create with the correct priority for all tasks */
-    #define OS_TASK_INIT_ALL() BEERTOS_PRIORITY_LIST()
-    OS_TASK_INIT_ALL();
+    if (prev != NULL)
+    {
+        prev->delay_next = task;
+    }
+    else
+    {
+        os_delay_list = task;
+    }
 
-    /* Idle task must be always created */
-    os_task_create(&os_idle_task_control, os_idle_task, os_idle_task_stack,
-                   sizeof(os_idle_task_stack), 0U, NULL);
-    BEERTOS_TRACE_TASK_CREATE(&os_idle_task_control, "OS_TASK_IDLE",
-                              sizeof(os_idle_task_stack));
+    BEERTOS_TASK_DELAY_SET(task->priority);
 }
 
-static void os_tasks_start(void)
+/**
+ * @brief Remove the task with the given priority from the delta list, if it is delayed.
+ *
+ * @param priority - priority of the task
+ * @return None
+ */
+static inline void os_task_delay_remove(const os_task_prio_t priority)
 {
-    /* Start from 1, since OS_TASK_IDLE is already started */
-    uint8_t task_id = 1U;
-    #undef BEERTOS_TASK
-    #undef BEERTOS_MUTEX
-    #undef BEERTOS_ALARM_TASK
-
-    /* X-Macro to call os_task_start if autostart is true */
-    #define BEERTOS_TASK(name, cb, stack, autostart, argv) \
-        if (autostart)                                     \
-        {                                                  \
-            os_task_start(task_id);                        \
-        }                                                  \
-        task_id++;
+    if (os_task_mask_test(&os_delay_mask, priority))
+    {
+        os_task_t *const task = os_tasks[priority];
 
-    #define BEERTOS_MUTEX(...) \
-        task_id++;
+        /* The remaining delay is passed to the next task */
+        if (task->delay_next != NULL)
+        {
+            task->delay_next->ticks += task->ticks;
+            task->delay_next->delay_prev = task->delay_prev;
+        }
 
-    #define BEERTOS_ALARM_TASK(...) \
-        task_id++;
+        if (task->delay_prev != NULL)
+        {
+            task->delay_prev->delay_next = task->delay_next;
+        }
+        else
+        {
+            os_delay_list = task->delay_next;
+        }
 
-    #define OS_TASK_START_ALL() BEERTOS_PRIORITY_LIST()
-    OS_TASK_START_ALL();
+        task->delay_next = NULL;
+        task->delay_prev = NULL;
+        BEERTOS_TASK_DELAY_CLEAR(priority);
+    }
+}
+#else
+static inline void os_task_delay_insert(os_task_t *const task, const uint32_t ticks)
+{
+    task->ticks = ticks;
+    BEERTOS_TASK_DELAY_SET(task->priority);
 }
 
-/**
- * @brief This function initializes the operating system's tasks.
- * It is responsible for setting up any necessary data structures.
- * Called once (automatically) in os system initialization.
- * If the task auto start is enabled, the task will be started.
- *
- * @param id - None
- * @return None
- */
-void os_task_module_init(void)
+static inline void os_task_delay_remove(const os_task_prio_t priority)
 {
-    os_ready_mask = 0U;
-    os_delay_mask = 0U;
-    os_tasks_init();
-    os_tasks_start();
+    BEERTOS_TASK_DELAY_CLEAR(priority);
 }
+#endif /* BEERTOS_USE_DELAY_LIST */
 
+#if (BEERTOS_USE_ROUND_ROBIN == true)
 /**
- * @brief This function starts the specified task.
+ * @brief Add the task to a round-robin group. Consecutive BEERTOS_RR_TASK entries with the
+ * same group number form one group, so the task joins the group of the task created just
+ * before it (one priority higher) if the group numbers match, otherwise it starts a new group.
  *
- * @param task_id - id of the task to be started
+ * @param priority - priority of the task
+ * @param group - group number from the configuration
  * @return None
  */
-bool os_task_start(const os_task_id_t id)
+static void os_task_rr_group_join(const os_task_prio_t priority, const uint32_t group)
 {
-    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-    BEERTOS_ASSERT(id < 255U, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-
-    const uint8_t priority = OS_TASK_MAX - id;
+    static os_task_prio_t last_priority = 0U;
+    static uint32_t last_group = 0U;
 
-    os_enter_critical_section();
+    os_task_prio_t top = priority;
 
-    BEERTOS_TASK_START(priority);
-    BEERTOS_TASK_DELAY_CLEAR(priority);
-    BEERTOS_TRACE_TASK_READY(os_tasks[priority]);
+    if ((last_priority == (priority + 1U)) && (last_group == group))
+    {
+        top = os_rr_group_top[last_priority];
+    }
+    else
+    {
+        /* The first (highest priority) member of the group runs first */
+        os_rr_next[top] = top;
+    }
 
-    os_leave_critical_section();
+    /* Update the lowest priority of all members */
+    for (uint32_t member = priority; member <= top; member++)
+    {
+        os_rr_group_low[member] = priority;
+    }
+    os_rr_group_top[priority] = top;
 
-    return true;
+    last_priority = priority;
+    last_group = group;
 }
 
 /**
- * @brief This function stops the specified task.
+ * @brief Select the task to run from the round-robin group of the given task.
+ * The group is found by the CLZ lookup of the ready mask, within the group the first ready
+ * member starting from the rotating position (in the descending priority order) is selected.
  *
- * @param task_id - id of the task to be stopped
- * @return None
+ * @param priority - highest priority of all ready tasks
+ * @return priority of the task to be run
  */
-bool os_task_stop(const os_task_id_t id)
+static inline os_task_prio_t os_task_rr_select(const os_task_prio_t priority)
 {
-    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
-    BEERTOS_ASSERT(id < 255U, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    const os_task_prio_t top = os_rr_group_top[priority];
 
-    const uint8_t priority = OS_TASK_MAX - id;
+    if (0U == top)
+    {
+        return priority;
+    }
 
-    os_enter_critical_section();
+    /* Highest ready member at or below the rotating position, no task above the group
+       is ready, so anything not below the group is a member. Wrap around otherwise. */
+    os_task_prio_t selected = os_task_mask_get_highest_below(&os_ready_mask, os_rr_next[top]);
 
-    BEERTOS_TASK_STOP(priority);
-    BEERTOS_TASK_DELAY_CLEAR(priority);
-    os_sched();
+    if (selected < os_rr_group_low[priority])
+    {
+        selected = priority;
+    }
 
-    os_leave_critical_section();
+    os_rr_next[top] = selected;
 
-    return true;
+    return selected;
 }
 
 /**
- * @brief Release the task that was previously suspended (for example by a mutex or a semaphore)
- * After calling this function, the scheduler is called to switch context to another task.
+ * @brief Consume one tick of the current task's time slice. When the time slice expires,
+ * the rotating position of the group is moved to the next member, which is selected by the
+ * scheduler if it is ready.
  *
- * @param task_id - id of the task to be released
+ * @param None
+ * @return None
  */
-void os_task_release(const os_task_id_t id)
+static inline void os_task_rr_tick(void)
 {
-    os_enter_critical_section();
+    const os_task_t *const task = os_task_current;
 
-    (void)os_task_start(id);
-    os_sched();
+    if ((NULL != task) && (0U != os_rr_group_top[task->priority]))
+    {
+        if (os_rr_quantum > 1U)
+        {
+            os_rr_quantum--;
+        }
+        else
+        {
+            const os_task_prio_t top = os_rr_group_top[task->priority];
 
-    os_leave_critical_section();
+            /* Rotate to the next member, wrap around to the top of the group */
+            os_rr_next[top] = (task->priority > os_rr_group_low[task->priority]) ? (task->priority - 1U) : top;
+            os_rr_quantum = BEERTOS_ROUND_ROBIN_QUANTUM;
+            os_sched_pending = true;
+        }
+    }
 }
+#endif /* BEERTOS_USE_ROUND_ROBIN */
 
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
 /**
- * @brief This function deletes (removes from scheduler) the current task.
- * Becasue current implementation does not support dynamic memory allocation,
- * the task stack is not freed. This function only removes the task from the
- * list of tasks to be scheduled.
- * After calling this function, the scheduler is called to switch context to another task.
+ * @brief Set the preemption threshold of a task defined with BEERTOS_THRESHOLD_TASK.
  *
- * @param None
+ * @param priority - priority of the task
+ * @param threshold - id of the highest priority task which must not preempt the task
  * @return None
  */
-void os_task_delete(void)
+static void os_task_threshold_set(const os_task_prio_t priority, const os_task_id_t threshold)
 {
-    os_enter_critical_section();
-
-    os_task_stop(OS_GET_TASK_ID_FROM_PRIORITY(os_task_current->priority));
-    os_tasks[os_task_current->priority] = NULL;
-    os_sched();
-
-    os_leave_critical_section();
+    os_tasks[priority]->preempt_threshold = OS_TASK_MAX - threshold;
 }
 
 /**
- * @brief Delay the current task for the specified number of ticks.
- * After the specified number of ticks, the task will be ready to run again.
- * After calling this function, the scheduler is called to switch context to another task.
+ * @brief Apply the preemption thresholds to the task selected by the scheduler. A threshold task
+ * keeps its threshold from its dispatch until it blocks, also while it is preempted by a task
+ * above the threshold, so the dispatched threshold tasks form a stack. The task on the top of
+ * the stack runs instead of the selected task, unless the selected task is above its threshold.
  *
- * @param ticks - number of ticks to delay, must be > 0
- * @return None
+ * @param next - highest priority ready task
+ * @return task to be run
  */
-void os_delay(const uint32_t ticks)
+static inline os_task_t *os_task_threshold_select(os_task_t *const next)
 {
-    os_enter_critical_section();
+    /* Remove the tasks which blocked since their dispatch */
+    while ((NULL != os_threshold_top) && !os_task_mask_test(&os_ready_mask, os_threshold_top->priority))
+    {
+        os_threshold_top = os_threshold_top->threshold_prev;
+    }
 
-    os_task_current->ticks = ticks;
-    BEERTOS_TASK_DELAY_SET(os_task_current->priority);
-    BEERTOS_TASK_STOP(os_task_current->priority);
-    BEERTOS_TRACE_TASK_DELAYED(os_task_current);
+    os_task_t *const top = os_threshold_top;
+
+    if ((NULL != top) && (next->priority > top->priority) && (next->priority <= top->preempt_threshold))
+    {
+        return top;
+    }
 
-    os_sched();
+    if ((next != top) && (next->preempt_threshold > next->priority))
+    {
+        /* The threshold is in effect from the dispatch of the task */
+        next->threshold_prev = top;
+        os_threshold_top = next;
+    }
 
-    os_leave_critical_section();
+    return next;
 }
+#endif /* BEERTOS_USE_PREEMPTION_THRESHOLD */
 
+#if (BEERTOS_USE_EDF == true)
 /**
- * @brief Process ticks for all tasks. This function is called by the system tick handler.
+ * @brief Add the task to the EDF group. Consecutive BEERTOS_EDF_TASK entries form the group,
+ * which is scheduled as a single priority level at the position of its first entry.
  *
- * @param None
+ * @param priority - priority of the task
+ * @param deadline - relative deadline in ticks
  * @return None
  */
-void os_task_tick(void)
+static void os_task_edf_join(const os_task_prio_t priority, const uint32_t deadline)
 {
-    uint32_t mask = os_delay_mask;
+    BEERTOS_ASSERT(deadline > 0U, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
 
-    /* Decrement ticks for all delayed tasks */
-    while (mask)
+    if (os_edf_top < os_edf_low)
     {
-        os_task_t *const task = os_tasks[OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask)];
-
-        task->ticks--;
-        if (task->ticks == 0)
-        {
-            /* Task is ready to run */
-            BEERTOS_TASK_START(task->priority);
-            BEERTOS_TASK_DELAY_CLEAR(task->priority);
-            BEERTOS_TRACE_TASK_READY(task);
-        }
-        /* Clear the delay bit from the mask */
-        mask &= ~(1 << (task->priority - 1U));
+        os_edf_top = priority;
     }
+    else
+    {
+        /* Only one group is supported, its entries must follow each other */
+        BEERTOS_ASSERT((priority + 1U) == os_edf_low, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    }
+    os_edf_low = priority;
+
+    os_tasks[priority]->edf_deadline = deadline;
+}
+
+static inline bool os_task_edf_member(const os_task_prio_t priority)
+{
+    return (priority >= os_edf_low) && (priority <= os_edf_top);
+}
+
+/*! Earlier absolute deadline first (tick wraparound safe), the higher priority on a tie */
+static inline bool os_task_edf_before(const os_task_t *const a, const os_task_t *const b)
+{
+    const int32_t diff = (int32_t)(a->edf_abs_deadline - b->edf_abs_deadline);
+
+    return (diff < 0) || ((0 == diff) && (a->priority > b->priority));
+}
+
+static inline void os_task_edf_place(os_task_t *const task, const uint32_t index)
+{
+    os_edf_heap[index] = task;
+    task->edf_index = (os_task_prio_t)index;
+}
+
+/**
+ * @brief Move the task from the given heap position up or down until the heap is ordered.
+ *
+ * @param task - task to be placed
+ * @param index - free position in the heap
+ * @return None
+ */
+static void os_task_edf_sift(os_task_t *const task, uint32_t index)
+{
+    while ((index > 0U) && os_task_edf_before(task, os_edf_heap[(index - 1U) / 2U]))
+    {
+        os_task_edf_place(os_edf_heap[(index - 1U) / 2U], index);
+        index = (index - 1U) / 2U;
+    }
+
+    while (true)
+    {
+        uint32_t child = (2U * index) + 1U;
+
+        if (child >= os_edf_heap_size)
+        {
+            break;
+        }
+        if (((child + 1U) < os_edf_heap_size) && os_task_edf_before(os_edf_heap[child + 1U], os_edf_heap[child]))
+        {
+            child++;
+        }
+        if (!os_task_edf_before(os_edf_heap[child], task))
+        {
+            break;
+        }
+        os_task_edf_place(os_edf_heap[child], index);
+        index = child;
+    }
+
+    os_task_edf_place(task, index);
+}
+
+/**
+ * @brief A task of the EDF group becomes ready - a new job is released, its absolute deadline
+ * is set from the current tick and the task is inserted into the deadline heap, O(log n).
+ * Must be called with interrupts disabled, before the task is set in the ready mask.
+ *
+ * @param priority - priority level made ready
+ * @return None
+ */
+static inline void os_task_edf_start(const os_task_prio_t priority)
+{
+    if (os_task_edf_member(priority) && !os_task_mask_test(&os_ready_mask, priority))
+    {
+        os_task_t *const task = os_tasks[priority];
+
+        task->edf_abs_deadline = os_get_tick_count() + task->edf_deadline;
+        os_edf_heap_size++;
+        os_task_edf_sift(task, os_edf_heap_size - 1U);
+    }
+}
+
+/**
+ * @brief A task of the EDF group stops being ready - it is removed from the deadline heap,
+ * O(log n). Must be called with interrupts disabled, before the task is cleared in the ready mask.
+ *
+ * @param priority - priority level to be stopped
+ * @return None
+ */
+static inline void os_task_edf_stop(const os_task_prio_t priority)
+{
+    if (os_task_edf_member(priority) && os_task_mask_test(&os_ready_mask, priority))
+    {
+        const uint32_t index = os_tasks[priority]->edf_index;
+
+        os_edf_heap_size--;
+        if (index < os_edf_heap_size)
+        {
+            /* The last task takes the free position */
+            os_task_edf_sift(os_edf_heap[os_edf_heap_size], index);
+        }
+    }
+}
+#endif /* BEERTOS_USE_EDF */
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+static void os_task_latency_clear(os_task_latency_t *const latency)
+{
+    latency->count = 0U;
+    latency->min = UINT32_MAX;
+    latency->max = 0U;
+    latency->last = 0U;
+    for (uint32_t i = 0U; i < BEERTOS_LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        latency->histogram[i] = 0U;
+    }
+}
+
+/**
+ * @brief Record the release timestamp of a task that is going to be made ready. Only blocked
+ * tasks are measured - not the running task and not before the scheduler is started. In an
+ * interrupt the entry of the outermost interrupt is used. Must be called with interrupts disabled.
+ *
+ * @param priority - priority of the released task
+ * @return None
+ */
+static inline void os_task_latency_release(const os_task_prio_t priority)
+{
+    os_task_t *const task = os_tasks[priority];
+
+    if ((NULL != task) && (NULL != os_task_current) && (task != os_task_current) &&
+        !os_task_mask_test(&os_ready_mask, priority))
+    {
+        task->release_timestamp = (0U != os_isr_nesting) ? os_isr_timestamp : os_port_get_timestamp();
+        task->release_pending = true;
+    }
+}
+#endif /* BEERTOS_USE_LATENCY_STATS */
+
+/**
+ * @brief Initialize the scheduling state of a task control block and register the task
+ * at its priority level.
+ *
+ * @param task - task control block
+ * @param priority - priority of the task
+ * @return None
+ */
+static void os_task_control_init(os_task_t *const task, const os_task_prio_t priority)
+{
+    task->priority = priority;
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    task->preempt_threshold = priority;
+#endif
+#if (BEERTOS_USE_EDF == true)
+    task->edf_deadline = 0U;
+#endif
+    task->ticks = 0U;
+#if (BEERTOS_USE_DELAY_LIST == true)
+    task->delay_next = NULL;
+    task->delay_prev = NULL;
+#endif
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    task->runtime = 0U;
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    task->release_pending = false;
+    os_task_latency_clear(&task->latency);
+#endif
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    task->notify_value = 0U;
+    task->notify_state = OS_TASK_NOTIFY_STATE_NONE;
+#endif
+#if (BEERTOS_WDG_MODULE_EN == true)
+    task->wdg_slot = 0U;
+#endif
+
+    os_tasks[priority] = task;
+}
+
+static void os_task_create(os_task_t *const task,
+                           const os_task_handler task_handler,
+                           void *const stack,
+                           const uint32_t stack_size,
+                           const os_task_prio_t priority,
+                           const void *const argv)
+{
+    BEERTOS_ASSERT(os_tasks[priority] == NULL, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(task != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(task_handler != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(stack != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(priority < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    os_stack_t *stack_ptr = os_port_task_stack_init(task_handler, argv, stack, stack_size);
+
+    /* Set stack pointer */
+    task->sp = (void *)stack_ptr;
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+    task->stack_guard = (uint32_t)(uintptr_t)stack;
+#endif
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    task->basic = NULL;
+#endif
+    os_task_control_init(task, priority);
+}
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/**
+ * @brief Create a basic task. The task has no context until it is activated and dispatched,
+ * see os_task_basic_dispatch.
+ *
+ * @param task - task control block
+ * @param basic - configuration of the basic task
+ * @param priority - priority of the task
+ * @return None
+ */
+static void os_task_create_basic(os_task_t *const task,
+                                 const os_task_basic_cfg_t *const basic,
+                                 const os_task_prio_t priority)
+{
+    BEERTOS_ASSERT(os_tasks[priority] == NULL, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(basic->handler != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(priority < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    task->sp = NULL;
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+    task->stack_guard = (uint32_t)(uintptr_t)os_basic_task_stack;
+#endif
+    task->basic = basic;
+    task->basic_stack = NULL;
+    task->basic_state = OS_TASK_BASIC_SUSPENDED;
+    os_task_control_init(task, priority);
+}
+
+/**
+ * @brief Returns the basic task of the priority level given by id, NULL if the level is not
+ * a basic task (a mutex slot locked by a basic task holds the task as well).
+ *
+ * @param id - id of the task
+ * @return task control block of the basic task or NULL
+ */
+static inline os_task_t *os_task_get_basic(const os_task_id_t id)
+{
+    os_task_t *const task = (OS_TASK_IDLE != id) ? os_tasks[OS_TASK_MAX - id] : NULL;
+
+    return ((NULL != task) && (NULL != task->basic) && (id == task->basic->id)) ? task : NULL;
+}
+
+/**
+ * @brief Entry of all basic tasks. The task function is run to completion, then the task gives
+ * back its part of the shared stack and is stopped. Its context is never resumed - if another
+ * basic task is dispatched before the switch, it continues here in place of the completed one.
+ *
+ * @param argv - task control block of the basic task
+ * @return None
+ */
+static void os_task_basic_entry(void *argv)
+{
+    os_task_t *task = (os_task_t *)argv;
+
+    while (1)
+    {
+        task->basic->handler(task->basic->argv);
+
+        const os_crit_state_t crit_state = os_enter_critical_section();
+
+        /* All mutexes must be unlocked */
+        BEERTOS_ASSERT(task->priority == (OS_TASK_MAX - task->basic->id), OS_MODULE_ID_TASK, OS_ERROR_INVALID_STATE);
+
+        task->basic_state = OS_TASK_BASIC_SUSPENDED;
+        task->basic_stack = NULL;
+        os_basic_task_completed = task;
+        BEERTOS_TASK_STOP(task->priority);
+
+        os_leave_critical_section(crit_state);
+
+        /* Reached only if a basic task was dispatched in place of this one */
+        task = os_task_current;
+    }
+}
+
+/**
+ * @brief Give the activated basic task its part of the shared stack. Basic tasks never block,
+ * so the dispatched ones complete in the reverse order - the task is placed right below the
+ * lowest dispatched task. Called by the scheduler, must be called with interrupts disabled.
+ *
+ * @param task - activated basic task selected to run
+ * @return None
+ */
+static void os_task_basic_dispatch(os_task_t *const task)
+{
+    os_stack_t *top = &os_basic_task_stack[BEERTOS_BASIC_TASK_STACK_SIZE];
+    const uint32_t words = task->basic->stack_size / sizeof(os_stack_t);
+
+    for (uint32_t i = 0U; NULL != os_basic_tasks[i]; i++)
+    {
+        if ((NULL != os_basic_tasks[i]->basic_stack) && (os_basic_tasks[i]->basic_stack < top))
+        {
+            top = os_basic_tasks[i]->basic_stack;
+        }
+    }
+
+    /* The chain of preempted basic tasks is deeper than the shared stack */
+    BEERTOS_ASSERT((uint32_t)(top - &os_basic_task_stack[OS_TASK_STACK_GUARD_WORDS]) >= words,
+                   OS_MODULE_ID_TASK, OS_ERROR_NO_MEMORY);
+
+    task->basic_stack = top - words;
+    task->basic_state = OS_TASK_BASIC_RUNNING;
+
+    const uint32_t used = (uint32_t)(&os_basic_task_stack[BEERTOS_BASIC_TASK_STACK_SIZE] - task->basic_stack) *
+                          sizeof(os_stack_t);
+    if (used > os_basic_task_stack_peak)
+    {
+        os_basic_task_stack_peak = used;
+    }
+
+    if ((NULL != os_task_current) && (os_task_current == os_basic_task_completed))
+    {
+        /* The function of the current task has returned, but the task was not switched out yet,
+           its frames are at the top of the same part of the stack - continue in its context */
+        task->sp = os_task_current->sp;
+        os_basic_task_completed = NULL;
+        os_task_current = task;
+#if defined(BEERTOS_TRACE_TASK_SWITCHED) || (BEERTOS_USE_RUNTIME_STATS == true) || \
+    (BEERTOS_USE_LATENCY_STATS == true)
+        os_context_switched_cb();
+#endif
+    }
+    else
+    {
+        if (task == os_basic_task_completed)
+        {
+            os_basic_task_completed = NULL;
+        }
+        task->sp = os_port_task_stack_init(os_task_basic_entry, task, task->basic_stack,
+                                           task->basic->stack_size);
+    }
+}
+#endif /* BEERTOS_USE_BASIC_TASKS */
+
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+/**
+ * @brief Function of all periodic tasks. The job function is released at the absolute ticks
+ * offset + n * period, so the releases do not drift with the execution time of the jobs.
+ * The response time of each job (from its release until the job function returns) is added
+ * to the statistics, a job completed at or after its deadline is counted as a miss and
+ * reported by BEERTOS_DEADLINE_MISS_CB. A job released while the previous one still runs is
+ * started right after it, the following releases keep the original phase.
+ *
+ * @param argv - configuration and statistics of the periodic task
+ * @return None
+ */
+static void os_task_periodic_entry(void *argv)
+{
+    os_task_periodic_t *const periodic = (os_task_periodic_t *)argv;
+    uint32_t release = periodic->offset;
+
+    while (1)
+    {
+        os_crit_state_t crit_state = os_enter_critical_section();
+
+        /* Ticks until the release, not positive if the release has already passed */
+        const int32_t ticks = (int32_t)(release - os_get_tick_count());
+        if (ticks > 0)
+        {
+            /* Context switch is performed when leaving the critical section */
+            os_delay((uint32_t)ticks);
+        }
+
+        os_leave_critical_section(crit_state);
+
+        periodic->handler();
+
+        const uint32_t response = os_get_tick_count() - release;
+        const bool missed = (response >= periodic->deadline);
+
+        crit_state = os_enter_critical_section();
+
+        periodic->jobs++;
+        periodic->response_sum += response;
+        periodic->response_last = response;
+        if (response > periodic->response_max)
+        {
+            periodic->response_max = response;
+        }
+        if (missed)
+        {
+            periodic->misses++;
+        }
+
+        os_leave_critical_section(crit_state);
+
+        if (missed)
+        {
+            BEERTOS_DEADLINE_MISS_CB(periodic->id, response);
+        }
+
+        release += periodic->period;
+    }
+}
+#endif /* BEERTOS_USE_PERIODIC_TASKS */
+
+static void os_idle_task(void *argv)
+{
+    BEERTOS_IDLE_TASK_INIT_CB();
+
+    while (1)
+    {
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+        os_task_stack_scan_step();
+#endif
+        BEERTOS_IDLE_TASK_CB();
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+        os_tickless_idle();
+#endif
+    }
+}
+
+static void os_tasks_init(void)
+{
+    /* Start from the max priority, since BEERTOS_PRIORITY_LIST 
+       is defined from the highest priority to the lowest */
+    os_task_prio_t priority = OS_TASK_MAX - 1U;
+
+    #undef BEERTOS_TASK
+    #undef BEERTOS_MUTEX
+    #undef BEERTOS_ALARM_TASK
+    #undef BEERTOS_RR_TASK
+    #undef BEERTOS_DEFER_TASK
+    #undef BEERTOS_POOL_TASK
+    #undef BEERTOS_BASIC_TASK
+    #undef BEERTOS_THRESHOLD_TASK
+    #undef BEERTOS_EDF_TASK
+    #undef BEERTOS_PERIODIC_TASK
+
+    /* X-Macro to call os_task_create for all tasks */
+    #define BEERTOS_TASK(name, cb, stack, autostart, argv)          \
+        os_task_create(&name##_control, cb, name##_stack,           \
+                       sizeof(name##_stack), priority, argv);       \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);   \
+        priority--;
+
+    #define BEERTOS_ALARM_TASK(name, stack)                          \
+        os_task_create(&name##_control, os_alarm_task, name##_stack, \
+                       sizeof(name##_stack), priority, NULL);        \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);    \
+        priority--;
+
+    #define BEERTOS_DEFER_TASK(name, stack)                          \
+        os_task_create(&name##_control, os_defer_task, name##_stack, \
+                       sizeof(name##_stack), priority, NULL);        \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);    \
+        priority--;
+
+    #define BEERTOS_RR_TASK(name, cb, stack, autostart, argv, group) \
+        os_task_create(&name##_control, cb, name##_stack,            \
+                       sizeof(name##_stack), priority, argv);        \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);    \
+        OS_TASK_RR_GROUP_JOIN(priority, group);                      \
+        priority--;
+    #define BEERTOS_THRESHOLD_TASK(name, cb, stack, autostart, argv, threshold) \
+        os_task_create(&name##_control, cb, name##_stack,                     \
+                       sizeof(name##_stack), priority, argv);                 \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);             \
+        OS_TASK_THRESHOLD_SET(priority, threshold);                           \
+        priority--;
+    #define BEERTOS_EDF_TASK(name, cb, stack, autostart, argv, deadline) \
+        os_task_create(&name##_control, cb, name##_stack,               \
+                       sizeof(name##_stack), priority, argv);           \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);       \
+        OS_TASK_EDF_JOIN(priority, deadline);                           \
+        priority--;
+    #define BEERTOS_PERIODIC_TASK(name, cb, stack, period, offset, deadline) \
+        os_task_create(&name##_control, os_task_periodic_entry,             \
+                       name##_stack, sizeof(name##_stack), priority,        \
+                       &name##_periodic);                                   \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);           \
+        priority--;
+
+    #define BEERTOS_MUTEX(name, ...)   \
+        os_tasks[priority] = NULL;     \
+        priority--;
+
+    #define BEERTOS_POOL_TASK(name)    \
+        os_tasks[priority] = NULL;     \
+        priority--;
+
+    #define BEERTOS_BASIC_TASK(name, cb, stack, autostart, argv)          \
+        os_task_create_basic(&name##_control, &name##_basic, priority);   \
+        BEERTOS_TRACE_TASK_CREATE(&name##_control, #name, stack);         \
+        priority--;
+
+    /* This macro calls os_task_create with the correct priority for all tasks */
+    #define OS_TASK_INIT_ALL() BEERTOS_PRIORITY_LIST()
+    OS_TASK_INIT_ALL();
+
+    /* Idle task must be always created */
+    os_task_create(&os_idle_task_control, os_idle_task, os_idle_task_stack,
+                   sizeof(os_idle_task_stack), 0U, NULL);
+    BEERTOS_TRACE_TASK_CREATE(&os_idle_task_control, "OS_TASK_IDLE",
+                              sizeof(os_idle_task_stack));
+}
+
+static void os_tasks_start(void)
+{
+    /* Start from 1, since OS_TASK_IDLE is already started */
+    uint32_t task_id = 1U;
+    #undef BEERTOS_TASK
+    #undef BEERTOS_MUTEX
+    #undef BEERTOS_ALARM_TASK
+    #undef BEERTOS_RR_TASK
+    #undef BEERTOS_DEFER_TASK
+    #undef BEERTOS_POOL_TASK
+    #undef BEERTOS_BASIC_TASK
+    #undef BEERTOS_THRESHOLD_TASK
+    #undef BEERTOS_EDF_TASK
+    #undef BEERTOS_PERIODIC_TASK
+
+    /* X-Macro to call os_task_start if autostart is true */
+    #define BEERTOS_TASK(name, cb, stack, autostart, argv) \
+        if (autostart)                                     \
+        {                                                  \
+            os_task_start(task_id);                        \
+        }                                                  \
+        task_id++;
+
+    #define BEERTOS_MUTEX(...) \
+        task_id++;
+
+    #define BEERTOS_ALARM_TASK(...) \
+        task_id++;
+
+    #define BEERTOS_DEFER_TASK(...) \
+        task_id++;
+
+    #define BEERTOS_POOL_TASK(...) \
+        task_id++;
+
+    #define BEERTOS_BASIC_TASK(name, cb, stack, autostart, argv) \
+        if (autostart)                                           \
+        {                                                        \
+            os_task_start(task_id);                              \
+        }                                                        \
+        task_id++;
+
+    #define BEERTOS_RR_TASK(name, cb, stack, autostart, argv, group) \
+        if (autostart)                                               \
+        {                                                            \
+            os_task_start(task_id);                                  \
+        }                                                            \
+        task_id++;
+    #define BEERTOS_THRESHOLD_TASK(name, cb, stack, autostart, argv, threshold) \
+        if (autostart)                                                        \
+        {                                                                     \
+            os_task_start(task_id);                                           \
+        }                                                                     \
+        task_id++;
+    #define BEERTOS_EDF_TASK(name, cb, stack, autostart, argv, deadline) \
+        if (autostart)                                                  \
+        {                                                               \
+            os_task_start(task_id);                                     \
+        }                                                               \
+        task_id++;
+    /* Periodic tasks are always started, the first job waits for the offset */
+    #define BEERTOS_PERIODIC_TASK(...) \
+        os_task_start(task_id);        \
+        task_id++;
+
+    #define OS_TASK_START_ALL() BEERTOS_PRIORITY_LIST()
+    OS_TASK_START_ALL();
+}
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/**
+ * @brief Link all slots of a stack class into its free list.
+ *
+ * @param stack_class - stack class
+ * @param slots - slots of the class
+ * @param stacks - stacks of the class, one after another
+ * @param stack_words - stack size of the class in os_stack_t words
+ * @param count - number of slots of the class
+ * @return None
+ */
+static void os_task_pool_class_init(const os_stack_class_t stack_class,
+                                    os_task_pool_slot_t *const slots,
+                                    os_stack_t *const stacks,
+                                    const uint32_t stack_words,
+                                    const uint32_t count)
+{
+    os_task_pool_free[stack_class] = NULL;
+
+    for (uint32_t i = count; i-- > 0U;)
+    {
+        slots[i].stack = &stacks[i * stack_words];
+        slots[i].stack_size = stack_words * sizeof(os_stack_t);
+        slots[i].stack_class = stack_class;
+        slots[i].next_free = os_task_pool_free[stack_class];
+        os_task_pool_free[stack_class] = &slots[i];
+    }
+}
+
+static void os_task_pool_init(void)
+{
+    #undef OS_STACK_CLASS
+    #define OS_STACK_CLASS(name, stack, count)                                          \
+        os_task_pool_class_init(name, name##_pool_slots, &name##_pool_stacks[0][0], \
+                                stack, count);
+
+    BEERTOS_TASK_POOL_LIST()
+}
+#endif /* BEERTOS_USE_TASK_POOL */
+
+/**
+ * @brief This function initializes the operating system's tasks.
+ * It is responsible for setting up any necessary data structures.
+ * Called once (automatically) in os system initialization.
+ * If the task auto start is enabled, the task will be started.
+ *
+ * @param id - None
+ * @return None
+ */
+void os_task_module_init(void)
+{
+    os_task_mask_reset(&os_ready_mask);
+    os_task_mask_reset(&os_delay_mask);
+    /* The idle task is selected on start, even if no task is started automatically */
+    os_sched_pending = true;
+#if (BEERTOS_USE_DELAY_LIST == true)
+    os_delay_list = NULL;
+#endif
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    os_threshold_top = NULL;
+#endif
+#if (BEERTOS_USE_EDF == true)
+    os_edf_heap_size = 0U;
+    os_edf_top = 0U;
+    os_edf_low = 1U;
+#endif
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    os_basic_task_completed = NULL;
+    os_basic_task_stack_peak = 0U;
+#if (OS_TASK_STACK_FILL == true)
+    for (uint32_t i = 0U; i < BEERTOS_BASIC_TASK_STACK_SIZE; i++)
+    {
+        os_basic_task_stack[i] = OS_TASK_STACK_PATTERN;
+    }
+#endif
+#endif
+    os_tasks_init();
+#if (BEERTOS_USE_TASK_POOL == true)
+    os_task_pool_init();
+#endif
+    os_tasks_start();
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    os_runtime_task = NULL;
+    os_runtime_total = 0U;
+    os_runtime_load_total = 0U;
+    os_runtime_load_idle = 0U;
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    os_isr_nesting = 0U;
+#endif
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    /* Stacks are reported as free until they are scanned */
+    for (uint32_t id = 0U; id < OS_TASK_MAX; id++)
+    {
+        os_task_stack_free[id] = os_task_stack_sizes[id];
+    }
+    os_task_stack_scan_id = 0U;
+    os_task_stack_scan_word = 0U;
+#endif
+}
+
+/**
+ * @brief This function starts the specified task. A basic task is activated, it runs to
+ * completion on the shared stack.
+ *
+ * @param task_id - id of the task to be started
+ * @return false if the task is a basic task which is already activated, true otherwise
+ */
+bool os_task_start(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    const os_task_prio_t priority = OS_TASK_MAX - id;
+
+    bool started = true;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    os_task_t *const basic = os_task_get_basic(id);
+
+    if (NULL != basic)
+    {
+        /* Activations are not queued, the task can be activated again when its function returned */
+        started = (OS_TASK_BASIC_SUSPENDED == basic->basic_state);
+        if (started)
+        {
+            basic->basic_state = OS_TASK_BASIC_ACTIVATED;
+        }
+    }
+
+    if (started)
+#endif
+    {
+        OS_TASK_LATENCY_RELEASE(priority);
+        BEERTOS_TASK_START(priority);
+        os_task_delay_remove(priority);
+        BEERTOS_TRACE_TASK_READY(os_tasks[priority]);
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return started;
+}
+
+/**
+ * @brief This function starts the specified task from an interrupt. The task is not scheduled
+ * here, call os_port_yield_from_isr(task_woken) at the end of the interrupt.
+ *
+ * @param task_id - id of the task to be started
+ * @param task_woken - optional, set to true if the started task has a higher priority than
+ *                     the interrupted task
+ * @return false if the task is a basic task which is already activated, true otherwise
+ */
+bool os_task_start_from_isr(const os_task_id_t id, bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const bool started = os_task_start(id);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
+
+    return started;
+}
+
+/**
+ * @brief This function stops the specified task.
+ *
+ * @param task_id - id of the task to be stopped
+ * @return None
+ */
+bool os_task_stop(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    const os_task_prio_t priority = OS_TASK_MAX - id;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    os_task_t *const basic = os_task_get_basic(id);
+
+    if (NULL != basic)
+    {
+        /* A dispatched basic task uses the shared stack until its function returns,
+           only an activation which was not dispatched yet can be cancelled */
+        BEERTOS_ASSERT(OS_TASK_BASIC_RUNNING != basic->basic_state, OS_MODULE_ID_TASK, OS_ERROR_INVALID_OPERATION);
+        if (OS_TASK_BASIC_ACTIVATED == basic->basic_state)
+        {
+            basic->basic_state = OS_TASK_BASIC_SUSPENDED;
+        }
+    }
+#endif
+
+    BEERTOS_TASK_STOP(priority);
+    os_task_delay_remove(priority);
+
+    os_leave_critical_section(crit_state);
+
+    return true;
+}
+
+/**
+ * @brief Release the task that was previously suspended (for example by a mutex or a semaphore)
+ * The context is switched to the released task (if it has higher priority) when the outermost
+ * critical section is left.
+ *
+ * @param task_id - id of the task to be released
+ */
+void os_task_release(const os_task_id_t id)
+{
+    (void)os_task_start(id);
+}
+
+/**
+ * @brief This function deletes (removes from scheduler) the current task.
+ * Becasue current implementation does not support dynamic memory allocation,
+ * the task stack is not freed. This function only removes the task from the
+ * list of tasks to be scheduled. Tasks created by os_task_create_dynamic()
+ * return their slot to the task pool.
+ * After calling this function, the scheduler is called to switch context to another task.
+ *
+ * @param None
+ * @return None
+ */
+void os_task_delete(void)
+{
+    /* Basic tasks return from their function instead */
+    OS_TASK_ASSERT_CAN_BLOCK();
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    const os_task_id_t id = OS_GET_TASK_ID_FROM_PRIORITY(os_task_current->priority);
+
+#if (BEERTOS_WDG_MODULE_EN == true)
+    /* The task control block can be reused by another task */
+    os_wdg_unregister();
+#endif
+    os_task_stop(id);
+    os_tasks[os_task_current->priority] = NULL;
+
+#if (BEERTOS_USE_TASK_POOL == true)
+    if (NULL != os_task_pool_names[id])
+    {
+        /* The slot is reused only after this task is switched out, which happens before any
+           other task runs - the context is still saved to the stack of the slot. The stack
+           pointer is kept for the stack monitor of the switch, os_task_create_dynamic()
+           replaces it when the priority level is reused */
+        os_task_pool_slot_t *const slot = (os_task_pool_slot_t *)os_task_current;
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+        os_task_stack_sizes[id] = 0U;
+        os_task_stack_free[id] = 0U;
+#endif
+        slot->next_free = os_task_pool_free[slot->stack_class];
+        os_task_pool_free[slot->stack_class] = slot;
+    }
+#endif
+
+    os_leave_critical_section(crit_state);
+}
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/**
+ * @brief Create and start a task at runtime. The task control block and the stack are taken
+ * from a free slot of the stack class in O(1), without any heap. The task runs at the
+ * priority level of the BEERTOS_POOL_TASK entry given by id, until it calls os_task_delete(),
+ * which returns the slot to the pool (a task must never return from its handler).
+ * The stack is initialized in the critical section, its cost depends on the stack class.
+ *
+ * @param task_handler - task function
+ * @param argv - argument passed to the task function
+ * @param stack_class - stack class of the slot
+ * @param id - id of a BEERTOS_POOL_TASK priority level
+ * @return false if the priority level is used by another task or no slot of the stack
+ *         class is free, true if the task was created and started
+ */
+bool os_task_create_dynamic(const os_task_handler task_handler,
+                            void *const argv,
+                            const os_stack_class_t stack_class,
+                            const os_task_id_t id)
+{
+    BEERTOS_ASSERT(task_handler != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(stack_class < OS_STACK_CLASS_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(os_task_pool_names[id] != NULL, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    const os_task_prio_t priority = OS_TASK_MAX - id;
+    bool created = false;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_pool_slot_t *const slot = os_task_pool_free[stack_class];
+
+    if ((NULL != slot) && (NULL == os_tasks[priority]))
+    {
+        os_task_pool_free[stack_class] = slot->next_free;
+        slot->next_free = NULL;
+
+        os_task_create(&slot->control, task_handler, slot->stack, slot->stack_size, priority, argv);
+        BEERTOS_TRACE_TASK_CREATE(&slot->control, os_task_pool_names[id], slot->stack_size);
+        os_task_stacks[id] = slot->stack;
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+        os_task_stack_sizes[id] = slot->stack_size - OS_TASK_STACK_GUARD_SIZE;
+        os_task_stack_free[id] = os_task_stack_sizes[id];
+#endif
+        (void)os_task_start(id);
+        created = true;
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return created;
+}
+#endif /* BEERTOS_USE_TASK_POOL */
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/**
+ * @brief Get the deepest chain of basic tasks reached so far - the most bytes of the shared stack
+ * given to basic tasks at the same time (by their configured stack sizes). Compare it with
+ * BEERTOS_BASIC_TASK_STACK_SIZE to size the shared stack.
+ *
+ * @param None
+ * @return bytes of the shared stack
+ */
+uint32_t os_task_get_basic_stack_peak(void)
+{
+    return os_basic_task_stack_peak;
+}
+#endif /* BEERTOS_USE_BASIC_TASKS */
+
+/**
+ * @brief Delay the current task for the specified number of ticks.
+ * After the specified number of ticks, the task will be ready to run again.
+ * After calling this function, the scheduler is called to switch context to another task.
+ *
+ * @param ticks - number of ticks to delay, must be > 0
+ * @return None
+ */
+void os_delay(const uint32_t ticks)
+{
+    OS_TASK_ASSERT_CAN_BLOCK();
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_delay_insert(os_task_current, ticks);
+    BEERTOS_TASK_STOP(os_task_current->priority);
+    BEERTOS_TRACE_TASK_DELAYED(os_task_current);
+
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief Delay the current task until an absolute tick: *last_wake_time + period.
+ * Used to implement periodic tasks without cumulative drift - the wakeup time does not
+ * depend on how long the task body ran. The tick counter wraparound is handled by the
+ * unsigned arithmetic. If the wakeup time has already passed, the task is not delayed
+ * and the missed deadline is reported. In both cases *last_wake_time is advanced by
+ * exactly one period, so the task keeps its original phase.
+ *
+ * @param last_wake_time - pointer to the tick of the previous wakeup, initialize it with
+ *                         os_get_tick_count() before the first call
+ * @param period - period in ticks, must be > 0
+ * @return true if the deadline was met, false if the wakeup time has already passed
+ */
+bool os_delay_until(uint32_t *const last_wake_time, const uint32_t period)
+{
+    BEERTOS_ASSERT(last_wake_time != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+    BEERTOS_ASSERT(period > 0U, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    OS_TASK_ASSERT_CAN_BLOCK();
+
+    bool on_time = true;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    const uint32_t now = os_get_tick_count();
+    const uint32_t wake_time = *last_wake_time + period;
+    /* Ticks elapsed since the previous wakeup, correct also after the counter wraparound */
+    const uint32_t elapsed = now - *last_wake_time;
+
+    if (elapsed < period)
+    {
+        /* Context switch is performed when leaving the critical section */
+        os_delay(wake_time - now);
+    }
+    else if (elapsed > period)
+    {
+        /* The wakeup time has already passed */
+        on_time = false;
+    }
+    else
+    {
+        /* Exactly at the wakeup time, no need to delay */
+    }
+
+    *last_wake_time = wake_time;
+
+    os_leave_critical_section(crit_state);
+
+    return on_time;
+}
+
+/**
+ * @brief Advance all delayed tasks by the given number of ticks. Tasks whose delay expires
+ * are made ready to run.
+ *
+ * @param ticks - number of elapsed ticks
+ * @return None
+ */
+static inline void os_task_advance(uint32_t ticks)
+{
+#if (BEERTOS_USE_DELAY_LIST == true)
+    /* Wake up all tasks from the head of the list whose delay has expired */
+    while ((os_delay_list != NULL) && (os_delay_list->ticks <= ticks))
+    {
+        os_task_t *const task = os_delay_list;
+
+        ticks -= task->ticks;
+        task->ticks = 0U;
+
+        os_delay_list = task->delay_next;
+        if (os_delay_list != NULL)
+        {
+            os_delay_list->delay_prev = NULL;
+        }
+        task->delay_next = NULL;
+
+        /* Task is ready to run */
+        OS_TASK_LATENCY_RELEASE(task->priority);
+        BEERTOS_TASK_START(task->priority);
+        BEERTOS_TASK_DELAY_CLEAR(task->priority);
+        BEERTOS_TRACE_TASK_READY(task);
+    }
+
+    if (os_delay_list != NULL)
+    {
+        os_delay_list->ticks -= ticks;
+    }
+#else
+    os_task_mask_t mask = os_delay_mask;
+
+    /* Decrement ticks for all delayed tasks */
+    while (!os_task_mask_is_empty(&mask))
+    {
+        os_task_t *const task = os_tasks[os_task_mask_get_highest(&mask)];
+
+        task->ticks = (task->ticks > ticks) ? (task->ticks - ticks) : 0U;
+        if (task->ticks == 0)
+        {
+            /* Task is ready to run */
+            OS_TASK_LATENCY_RELEASE(task->priority);
+            BEERTOS_TASK_START(task->priority);
+            BEERTOS_TASK_DELAY_CLEAR(task->priority);
+            BEERTOS_TRACE_TASK_READY(task);
+        }
+        /* Clear the delay bit from the mask */
+        os_task_mask_clear(&mask, task->priority);
+    }
+#endif /* BEERTOS_USE_DELAY_LIST */
+}
+
+/**
+ * @brief Process ticks for all tasks. This function is called by the system tick handler.
+ *
+ * @param None
+ * @return None
+ */
+void os_task_tick(void)
+{
+    os_task_advance(1U);
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+    os_task_rr_tick();
+#endif
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/**
+ * @brief Process the ticks that elapsed while the tick interrupt was suppressed.
+ * Must be called with interrupts disabled.
+ *
+ * @param ticks - number of elapsed ticks
+ * @return None
+ */
+void os_task_tick_compensate(const uint32_t ticks)
+{
+    os_task_advance(ticks);
+}
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
+
+/**
+ * @brief Returns the number of ticks until the earliest delayed task is woken up.
+ * With BEERTOS_USE_DELAY_LIST the query takes constant time, otherwise all delayed
+ * tasks are scanned. Must be called with interrupts disabled.
+ *
+ * @param None
+ * @return 0 if any task is ready to run, UINT32_MAX if no task is delayed,
+ *         otherwise the number of ticks until the next wakeup
+ */
+uint32_t os_task_get_next_wakeup(void)
+{
+    uint32_t next_wakeup = UINT32_MAX;
+
+    if (!os_task_mask_is_empty(&os_ready_mask))
+    {
+        return 0U;
+    }
+
+#if (BEERTOS_USE_DELAY_LIST == true)
+    if (os_delay_list != NULL)
+    {
+        next_wakeup = os_delay_list->ticks;
+    }
+#else
+    os_task_mask_t mask = os_delay_mask;
+
+    while (!os_task_mask_is_empty(&mask))
+    {
+        const os_task_t *const task = os_tasks[os_task_mask_get_highest(&mask)];
+
+        if (task->ticks < next_wakeup)
+        {
+            next_wakeup = task->ticks;
+        }
+        os_task_mask_clear(&mask, task->priority);
+    }
+#endif /* BEERTOS_USE_DELAY_LIST */
+
+    return next_wakeup;
+}
+
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+/**
+ * @brief Send a notification to the task. The notification value of the task is updated
+ * according to the action and the task is woken up if it waits in os_task_notify_wait().
+ * Compared to a semaphore, no configuration is needed and the wakeup costs only the update
+ * of the task control block. Use os_task_notify_from_isr() in interrupts.
+ *
+ * @param id - id of the task to be notified
+ * @param bits - value used by the action (ignored by OS_TASK_NOTIFY_INCREMENT)
+ * @param action - how the notification value is updated
+ * @return false if the action is OS_TASK_NOTIFY_NO_OVERWRITE and the previous notification
+ *         was not taken yet (the value is not changed), true otherwise
+ */
+bool os_task_notify(const os_task_id_t id, const uint32_t bits, const os_task_notify_action_t action)
+{
+    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(os_tasks[OS_TASK_MAX - id] != NULL, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    bool notified = true;
+    os_task_t *const task = os_tasks[OS_TASK_MAX - id];
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    const uint8_t previous_state = task->notify_state;
+
+    switch (action)
+    {
+        case OS_TASK_NOTIFY_SET_BITS:
+            task->notify_value |= bits;
+            break;
+        case OS_TASK_NOTIFY_INCREMENT:
+            task->notify_value++;
+            break;
+        case OS_TASK_NOTIFY_OVERWRITE:
+            task->notify_value = bits;
+            break;
+        case OS_TASK_NOTIFY_NO_OVERWRITE:
+            if (previous_state == OS_TASK_NOTIFY_STATE_PENDING)
+            {
+                notified = false;
+            }
+            else
+            {
+                task->notify_value = bits;
+            }
+            break;
+        default:
+            BEERTOS_ASSERT(false, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+            notified = false;
+            break;
+    }
+
+    if (notified)
+    {
+        task->notify_state = OS_TASK_NOTIFY_STATE_PENDING;
+
+        if (previous_state == OS_TASK_NOTIFY_STATE_WAITING)
+        {
+            /* Wake up the task, the delay (timeout) is cancelled */
+            (void)os_task_start(id);
+        }
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return notified;
+}
+
+/**
+ * @brief Send a notification to the task from an interrupt, see os_task_notify().
+ * The woken up task is not scheduled here, call os_port_yield_from_isr(task_woken)
+ * at the end of the interrupt.
+ *
+ * @param id - id of the task to be notified
+ * @param bits - value used by the action (ignored by OS_TASK_NOTIFY_INCREMENT)
+ * @param action - how the notification value is updated
+ * @param task_woken - optional, set to true if the woken up task has a higher priority than
+ *                     the interrupted task
+ * @return false if the action is OS_TASK_NOTIFY_NO_OVERWRITE and the previous notification
+ *         was not taken yet (the value is not changed), true otherwise
+ */
+bool os_task_notify_from_isr(const os_task_id_t id,
+                             const uint32_t bits,
+                             const os_task_notify_action_t action,
+                             bool *const task_woken)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    const bool notified = os_task_notify(id, bits, action);
+
+    os_leave_critical_section_from_isr(crit_state, task_woken);
+
+    return notified;
+}
+
+/**
+ * @brief Wait for a notification of the current task. If no notification is pending, the task
+ * is blocked until it is notified or the timeout expires. The pending notification is taken,
+ * so the next call blocks again until the next notification.
+ *
+ * @param clear_mask - bits cleared in the notification value after it is read, use 0xFFFFFFFF
+ *                     to reset the value (binary semaphore or event flags), or 0 to keep it
+ * @param value - optional, the notification value (before clearing) is stored here
+ * @param timeout - maximum time to wait in ticks, 0 to return immediately
+ * @return true if a notification was taken, false if the timeout expired
+ */
+bool os_task_notify_wait(const uint32_t clear_mask, uint32_t *const value, const uint32_t timeout)
+{
+    os_task_t *const task = os_task_current;
+    bool notified;
+
+    os_crit_state_t crit_state = os_enter_critical_section();
+
+    if ((task->notify_state != OS_TASK_NOTIFY_STATE_PENDING) && (0U != timeout))
+    {
+        task->notify_state = OS_TASK_NOTIFY_STATE_WAITING;
+        os_delay(timeout);
+
+        os_leave_critical_section(crit_state);
+        /* Potencial context switch is right here */
+        crit_state = os_enter_critical_section();
+    }
+
+    notified = (task->notify_state == OS_TASK_NOTIFY_STATE_PENDING);
+
+    if (notified)
+    {
+        if (value != NULL)
+        {
+            *value = task->notify_value;
+        }
+        task->notify_value &= ~clear_mask;
+    }
+
+    task->notify_state = OS_TASK_NOTIFY_STATE_NONE;
+
+    os_leave_critical_section(crit_state);
+
+    return notified;
+}
+#endif /* BEERTOS_USE_TASK_NOTIFICATIONS */
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+/**
+ * @brief Measure the stack high-water mark of the task now. The stack is scanned from its base
+ * in the context of the caller, use os_task_get_stack_report() to get the values measured
+ * by the idle task without the scan.
+ *
+ * @param id - id of the task
+ * @return size, used and free bytes of the task stack
+ */
+os_task_stack_usage_t os_task_get_stack_high_water(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+#if (BEERTOS_USE_TASK_POOL == true)
+    const os_crit_state_t crit_state = os_enter_critical_section();
+#endif
+    const os_stack_t *const stack = os_task_stacks[id];
+    const uint32_t words = os_task_stack_sizes[id] / sizeof(os_stack_t);
+#if (BEERTOS_USE_TASK_POOL == true)
+    os_leave_critical_section(crit_state);
+#endif
+    uint32_t free_words = 0U;
+
+    while ((free_words < words) && (stack[OS_TASK_STACK_GUARD_WORDS + free_words] == OS_TASK_STACK_PATTERN))
+    {
+        free_words++;
+    }
+
+    os_task_stack_usage_t usage;
+
+    usage.size = words * sizeof(os_stack_t);
+    usage.free = free_words * sizeof(os_stack_t);
+    usage.used = usage.size - usage.free;
+    os_task_stack_free[id] = usage.free;
+
+    return usage;
+}
+
+/**
+ * @brief Get the stack usage of all tasks, as measured by the last scan of the idle task.
+ * Stacks which were not scanned yet are reported as free.
+ *
+ * @param report - array of OS_TASK_MAX entries indexed by the task id
+ * @return None
+ */
+void os_task_get_stack_report(os_task_stack_usage_t report[OS_TASK_MAX])
+{
+    BEERTOS_ASSERT(report != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+
+    for (uint32_t id = 0U; id < OS_TASK_MAX; id++)
+    {
+        report[id].size = os_task_stack_sizes[id];
+        report[id].free = os_task_stack_free[id];
+        report[id].used = os_task_stack_sizes[id] - os_task_stack_free[id];
+    }
+}
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
+
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+/**
+ * @brief Account the time since the last update to the task that was running and start
+ * accounting to the current task. Called by the port on every context switch (after
+ * os_task_current is updated), must be called with interrupts disabled.
+ *
+ * @param None
+ * @return None
+ */
+void os_task_runtime_update(void)
+{
+    const uint32_t now = os_port_get_timestamp();
+
+    if (NULL != os_runtime_task)
+    {
+        const uint32_t elapsed = now - os_runtime_timestamp;
+
+        os_runtime_task->runtime += elapsed;
+        os_runtime_total += elapsed;
+    }
+
+    os_runtime_timestamp = now;
+    os_runtime_task = os_task_current;
+}
+
+/**
+ * @brief Get the CPU time used by the task since it was created.
+ *
+ * @param id - id of the task, OS_TASK_IDLE for the idle time
+ * @return CPU time in port timestamp units (CPU cycles on Cortex-M4), 0 for mutex slots
+ */
+uint64_t os_task_get_runtime(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    const os_task_t *const task = os_tasks[(OS_TASK_IDLE == id) ? 0U : (OS_TASK_MAX - id)];
+    uint64_t runtime = 0U;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    /* Mutex slots have no stack, the slot holds the mutex owner while the mutex is locked */
+    if ((NULL != task) && (NULL != os_task_stacks[id]))
+    {
+        /* Include the time of the running task */
+        os_task_runtime_update();
+        runtime = task->runtime;
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return runtime;
+}
+
+/**
+ * @brief Get the CPU load since the previous call of this function (or since the start),
+ * computed from the time spent outside of the idle task.
+ *
+ * @param None
+ * @return CPU load in 0.01 % units (0 - 10000)
+ */
+uint32_t os_get_cpu_load(void)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_runtime_update();
+
+    const uint64_t total = os_runtime_total - os_runtime_load_total;
+    const uint64_t idle = os_tasks[0]->runtime - os_runtime_load_idle;
+
+    os_runtime_load_total = os_runtime_total;
+    os_runtime_load_idle = os_tasks[0]->runtime;
+
+    os_leave_critical_section(crit_state);
+
+    return (0U == total) ? 0U : (uint32_t)(((total - idle) * 10000U) / total);
+}
+#endif /* BEERTOS_USE_RUNTIME_STATS */
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+/**
+ * @brief Mark the entry of an interrupt, tasks released by the interrupt are measured from
+ * the entry of the outermost interrupt. Called by the port tick interrupt, application
+ * interrupts that release tasks call it first and os_isr_exit() last.
+ *
+ * @param None
+ * @return None
+ */
+void os_isr_enter(void)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    if (0U == os_isr_nesting)
+    {
+        os_isr_timestamp = os_port_get_timestamp();
+    }
+    os_isr_nesting++;
+
+    os_leave_critical_section_from_isr(crit_state, NULL);
+}
+
+/**
+ * @brief Mark the exit of an interrupt, must be paired with os_isr_enter().
+ *
+ * @param None
+ * @return None
+ */
+void os_isr_exit(void)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section_from_isr();
+
+    BEERTOS_ASSERT(os_isr_nesting > 0U, OS_MODULE_ID_TASK, OS_ERROR_INVALID_OPERATION);
+    os_isr_nesting--;
+
+    os_leave_critical_section_from_isr(crit_state, NULL);
+}
+
+/**
+ * @brief Account the wakeup latency of the task that is switched in, if it was released
+ * since it last ran. Called by the port on every context switch (after os_task_current is
+ * updated), must be called with interrupts disabled.
+ *
+ * @param None
+ * @return None
+ */
+void os_task_latency_update(void)
+{
+    os_task_t *const task = os_task_current;
+
+    if (!task->release_pending)
+    {
+        return;
+    }
+
+    const uint32_t latency = os_port_get_timestamp() - task->release_timestamp;
+    const uint32_t scaled = latency >> BEERTOS_LATENCY_HISTOGRAM_SHIFT;
+    uint32_t bucket = (0U == scaled) ? 0U : (uint32_t)OS_LOG2(scaled);
+
+    if (bucket >= BEERTOS_LATENCY_HISTOGRAM_BUCKETS)
+    {
+        bucket = BEERTOS_LATENCY_HISTOGRAM_BUCKETS - 1U;
+    }
+
+    task->release_pending = false;
+    task->latency.histogram[bucket]++;
+    task->latency.count++;
+    task->latency.last = latency;
+    if (latency < task->latency.min)
+    {
+        task->latency.min = latency;
+    }
+    if (latency > task->latency.max)
+    {
+        task->latency.max = latency;
+    }
+}
+
+/**
+ * @brief Get a consistent copy of the wakeup latency statistics of a task.
+ *
+ * @param id - id of the task
+ * @param latency - output, statistics of the task
+ * @return false for the idle task and mutex slots (they are never released), true otherwise
+ */
+bool os_task_get_latency(const os_task_id_t id, os_task_latency_t *const latency)
+{
+    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(latency != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+
+    const os_task_t *const task = os_tasks[OS_TASK_MAX - id];
+    bool ret = false;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    /* Mutex slots have no stack, the slot holds the mutex owner while the mutex is locked */
+    if ((NULL != task) && (NULL != os_task_stacks[id]))
+    {
+        *latency = task->latency;
+        ret = true;
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return ret;
+}
+
+/**
+ * @brief Clear the wakeup latency statistics of a task, e.g. after the startup phase.
+ *
+ * @param id - id of the task
+ * @return None
+ */
+void os_task_reset_latency(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id > OS_TASK_IDLE, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    os_task_t *const task = os_tasks[OS_TASK_MAX - id];
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    if ((NULL != task) && (NULL != os_task_stacks[id]))
+    {
+        os_task_latency_clear(&task->latency);
+    }
+
+    os_leave_critical_section(crit_state);
+}
+#endif /* BEERTOS_USE_LATENCY_STATS */
+
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+/**
+ * @brief Get a consistent copy of the response time statistics of a periodic task.
+ *
+ * @param id - id of the task
+ * @param stats - output, statistics of the task
+ * @return false if the task is not a periodic task, true otherwise
+ */
+bool os_task_get_periodic_stats(const os_task_id_t id, os_task_periodic_stats_t *const stats)
+{
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+    BEERTOS_ASSERT(stats != NULL, OS_MODULE_ID_TASK, OS_ERROR_NULLPTR);
+
+    const os_task_periodic_t *const periodic = os_task_periodic[id];
+    bool ret = false;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    if (NULL != periodic)
+    {
+        stats->jobs = periodic->jobs;
+        stats->misses = periodic->misses;
+        stats->response_max = periodic->response_max;
+        stats->response_last = periodic->response_last;
+        stats->response_mean = (periodic->jobs > 0U) ? (uint32_t)(periodic->response_sum / periodic->jobs) : 0U;
+        ret = true;
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return ret;
+}
+
+/**
+ * @brief Clear the response time statistics of a periodic task, e.g. after the startup phase.
+ * The releases of the task are not affected.
+ *
+ * @param id - id of the task
+ * @return None
+ */
+void os_task_reset_periodic_stats(const os_task_id_t id)
+{
+    BEERTOS_ASSERT(id < OS_TASK_MAX, OS_MODULE_ID_TASK, OS_ERROR_INVALID_PARAM);
+
+    os_task_periodic_t *const periodic = os_task_periodic[id];
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    if (NULL != periodic)
+    {
+        periodic->jobs = 0U;
+        periodic->misses = 0U;
+        periodic->response_max = 0U;
+        periodic->response_last = 0U;
+        periodic->response_sum = 0U;
+    }
+
+    os_leave_critical_section(crit_state);
+}
+#endif /* BEERTOS_USE_PERIODIC_TASKS */
+
+/**
+ * @brief Check if a task with a higher priority than the current task is ready to run, so the
+ * pending scheduler request results in a context switch. Must be called with interrupts disabled.
+ *
+ * @param None
+ * @return true if the current task will be preempted
+ */
+bool os_task_higher_priority_ready(void)
+{
+    if (os_task_mask_is_empty(&os_ready_mask))
+    {
+        return false;
+    }
+
+    const os_task_prio_t highest = os_task_mask_get_highest(&os_ready_mask);
+
+#if (BEERTOS_USE_EDF == true)
+    if ((NULL != os_task_current) && os_task_edf_member(highest) && os_task_edf_member(os_task_current->priority))
+    {
+        return (os_edf_heap[0] != os_task_current);
+    }
+#endif
+
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+    /* A member of a group released in the group runs on until the rotation moves on */
+    if ((NULL != os_task_current) && (0U != os_rr_group_top[highest]) &&
+        (os_rr_group_top[highest] == os_rr_group_top[os_task_current->priority]) &&
+        (os_rr_next[os_rr_group_top[highest]] == os_task_current->priority) &&
+        os_task_mask_test(&os_ready_mask, os_task_current->priority))
+    {
+        return false;
+    }
+#endif
+
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    /* A dispatched threshold task is preempted only by tasks above its threshold */
+    if ((NULL != os_task_current) && (os_threshold_top == os_task_current) &&
+        os_task_mask_test(&os_ready_mask, os_task_current->priority))
+    {
+        return (highest > os_task_current->preempt_threshold);
+    }
+#endif
+
+    return (NULL == os_task_current) || (highest > os_task_current->priority);
 }
 
 /**
- * @brief Function used for scheduling tasks. This function is called by the system tick handler.
+ * @brief Request the scheduler. The scheduler is run once, when the outermost critical
+ * section is left - several requests made inside one critical section (or one interrupt)
+ * result in at most one context switch.
  *
  * @param None
  * @return None
  */
 void os_sched(void)
 {
-    os_enter_critical_section();
+    const os_crit_state_t crit_state = os_enter_critical_section();
+    os_sched_pending = true;
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief Select the highest priority ready task and pend the context switch if it differs
+ * from the current task. Called by os_leave_critical_section() when os_sched_pending is set,
+ * must be called with interrupts disabled.
+ *
+ * @param None
+ * @return None
+ */
+void os_sched_process(void)
+{
+    os_sched_pending = false;
 
-    if (os_ready_mask == 0U)
+    if (os_task_mask_is_empty(&os_ready_mask))
     {
         /* No task is ready to run, run the idle task */
         os_task_next = os_tasks[OS_TASK_IDLE];
@@ -423,20 +2499,48 @@ void os_sched(void)
     else
     {
         /* Get the task with the highest priority */
-        os_task_next = os_tasks[OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(os_ready_mask)];
+        const os_task_prio_t highest = os_task_mask_get_highest(&os_ready_mask);
+
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+        os_task_next = os_tasks[os_task_rr_select(highest)];
+#else
+        os_task_next = os_tasks[highest];
+#endif
+#if (BEERTOS_USE_EDF == true)
+        if (os_task_edf_member(highest))
+        {
+            /* Within the EDF group the task with the earliest deadline runs */
+            os_task_next = os_edf_heap[0];
+        }
+#endif
+    }
+
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    os_task_next = os_task_threshold_select(os_task_next);
+#endif
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    if ((NULL != os_task_next->basic) && (OS_TASK_BASIC_ACTIVATED == os_task_next->basic_state))
+    {
+        os_task_basic_dispatch(os_task_next);
     }
+#endif
 
+#if (BEERTOS_USE_TASK_STACK_MONITOR == true)
     if (NULL != os_task_current)
     {
         /* Stack monitoring */
         os_task_stack_mon();
     }
+#endif
 
     /* Context switch if the next task is different from the current task */
     if (os_task_current != os_task_next)
     {
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+        /* The next task starts with a full time slice */
+        os_rr_quantum = BEERTOS_ROUND_ROBIN_QUANTUM;
+#endif
         os_port_context_switch();
     }
-
-    os_leave_critical_section();
 }
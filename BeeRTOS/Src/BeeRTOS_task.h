@@ -16,8 +16,7 @@
  *                                        INCLUDES                                        *
  ******************************************************************************************/
 
-#include "Beertos_internal.h"
-#include "BeeRTOS_mutex.h"
+#include "BeeRTOS_internal.h"
 
 /******************************************************************************************
  *                                         DEFINES                                        *
@@ -35,27 +34,66 @@
 #error "Only one stack monitor can be used at a time!"
 #endif
 
+#if (BEERTOS_USE_MPU_STACK_GUARD == true) && (BEERTOS_USE_TASK_STACK_MONITOR == true)
+#error "The stack monitor reads the MPU stack guard, disable BEERTOS_USE_TASK_STACK_MONITOR!"
+#endif
+
+/*! Stacks are aligned to the MPU guard region size, the guard is the lowest part of the stack */
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+#define OS_TASK_STACK_GUARD_SIZE (OS_PORT_STACK_GUARD_SIZE)
+#define OS_TASK_STACK_ALIGNED __attribute__((aligned(OS_PORT_STACK_GUARD_SIZE)))
+#else
+#define OS_TASK_STACK_GUARD_SIZE (0U)
+#define OS_TASK_STACK_ALIGNED
+#endif
+#define OS_TASK_STACK_GUARD_WORDS (OS_TASK_STACK_GUARD_SIZE / sizeof(os_stack_t))
+
+/*! The unused stack is filled with OS_TASK_STACK_PATTERN when a task is created */
+#if (BEERTOS_USE_TASK_STACK_MONITOR == true) || (BEERTOS_USE_STACK_HIGH_WATER == true)
+#define OS_TASK_STACK_FILL (true)
+#else
+#define OS_TASK_STACK_FILL (false)
+#endif
+
 /******************************************************************************************
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
 
-/*! OS Thread control block */
+typedef void (*os_task_handler)(void *args);
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+/*! Wakeup latency statistics of a task, in port timestamp units */
 typedef struct
 {
-    volatile void *sp; /*!< stack pointer */
-    uint32_t ticks;    /*!< ticks */
-    uint8_t priority;  /*!< priority */
-} os_task_t;
-
-typedef void (*os_task_handler)(void *args);
+    uint32_t count; /* number of measured wakeups */
+    uint32_t min;   /* shortest latency, UINT32_MAX if nothing was measured */
+    uint32_t max;   /* worst-case latency */
+    uint32_t last;  /* latency of the last wakeup */
+    uint32_t histogram[BEERTOS_LATENCY_HISTOGRAM_BUCKETS]; /* log2 buckets, see BeeRTOS_cfg.h */
+} os_task_latency_t;
+#endif
 
 #undef BEERTOS_TASK
 #undef BEERTOS_MUTEX
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 #define BEERTOS_TASK(task_name, ...) task_name,
 #define BEERTOS_MUTEX(task_name, ...) PRIO_CELLING_TASK_##task_name,
 #define BEERTOS_ALARM_TASK(task_name, ...) task_name,
+#define BEERTOS_DEFER_TASK(task_name, ...) task_name,
+#define BEERTOS_RR_TASK(task_name, ...) task_name,
+#define BEERTOS_THRESHOLD_TASK(task_name, ...) task_name,
+#define BEERTOS_EDF_TASK(task_name, ...) task_name,
+#define BEERTOS_PERIODIC_TASK(task_name, ...) task_name,
+#define BEERTOS_POOL_TASK(task_name) task_name,
+#define BEERTOS_BASIC_TASK(task_name, ...) task_name,
 
 /*! Task IDs - generated from BEERTOS_PRIORITY_LIST() in BeeRTOS_task_cfg.h */
 typedef enum
@@ -70,10 +108,122 @@ typedef enum
 #undef BEERTOS_TASK
 #undef BEERTOS_MUTEX
 #undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+#define BEERTOS_TASK(...)
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_ALARM_TASK(...)
+#define BEERTOS_DEFER_TASK(...)
+#define BEERTOS_RR_TASK(...)
+#define BEERTOS_THRESHOLD_TASK(...)
+#define BEERTOS_EDF_TASK(...)
+#define BEERTOS_PERIODIC_TASK(...)
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...) +1U
+
+#if (BEERTOS_USE_BASIC_TASKS != true) && ((0U BEERTOS_PRIORITY_LIST()) > 0U)
+#error "BEERTOS_BASIC_TASK entries need BEERTOS_USE_BASIC_TASKS!"
+#endif
+
+/*! Number of basic tasks */
+enum
+{
+    OS_BASIC_TASK_COUNT = 0U BEERTOS_PRIORITY_LIST()
+};
+
+/******************************************************************************************/
+
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+#define BEERTOS_TASK(...)
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_ALARM_TASK(...)
+#define BEERTOS_DEFER_TASK(...)
+#define BEERTOS_RR_TASK(...)
+#define BEERTOS_THRESHOLD_TASK(...)
+#define BEERTOS_EDF_TASK(...) +1U
+#define BEERTOS_PERIODIC_TASK(...)
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...)
+
+/*! Number of tasks scheduled by their deadlines */
+enum
+{
+    OS_EDF_TASK_COUNT = 0U BEERTOS_PRIORITY_LIST()
+};
+
+/******************************************************************************************/
+
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
+
+#define BEERTOS_TASK(...)
+#define BEERTOS_MUTEX(...)
+#define BEERTOS_ALARM_TASK(...)
+#define BEERTOS_DEFER_TASK(...)
+#define BEERTOS_RR_TASK(...)
+#define BEERTOS_THRESHOLD_TASK(...)
+#define BEERTOS_EDF_TASK(...)
+#define BEERTOS_PERIODIC_TASK(...) +1U
+#define BEERTOS_POOL_TASK(...)
+#define BEERTOS_BASIC_TASK(...)
+
+#if (BEERTOS_USE_PERIODIC_TASKS != true) && ((0U BEERTOS_PRIORITY_LIST()) > 0U)
+#error "BEERTOS_PERIODIC_TASK entries need BEERTOS_USE_PERIODIC_TASKS!"
+#endif
+
+/*! Number of periodic tasks */
+enum
+{
+    OS_PERIODIC_TASK_COUNT = 0U BEERTOS_PRIORITY_LIST()
+};
+
+/******************************************************************************************/
+
+#undef BEERTOS_TASK
+#undef BEERTOS_MUTEX
+#undef BEERTOS_ALARM_TASK
+#undef BEERTOS_RR_TASK
+#undef BEERTOS_DEFER_TASK
+#undef BEERTOS_POOL_TASK
+#undef BEERTOS_BASIC_TASK
+#undef BEERTOS_THRESHOLD_TASK
+#undef BEERTOS_EDF_TASK
+#undef BEERTOS_PERIODIC_TASK
 
 #define BEERTOS_TASK(...) +1U
 #define BEERTOS_MUTEX(...) +1U
 #define BEERTOS_ALARM_TASK(...) +1U
+#define BEERTOS_DEFER_TASK(...) +1U
+#define BEERTOS_RR_TASK(...) +1U
+#define BEERTOS_THRESHOLD_TASK(...) +1U
+#define BEERTOS_EDF_TASK(...) +1U
+#define BEERTOS_PERIODIC_TASK(...) +1U
+#define BEERTOS_POOL_TASK(...) +1U
+#define BEERTOS_BASIC_TASK(...) +1U
 
 /*! Returns the number of tasks, OS_TASK_MAX cannot be used in preprocessor expressions,
     because enum is known only after the preprocessor is done */
@@ -81,37 +231,221 @@ typedef enum
 
 /******************************************************************************************/
 
-/*! Check and select the proper mask type for the number of configured tasks */
-#if OS_TASK_COUNT <= 8U
-    typedef uint8_t os_task_mask_t;
-    #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK8(mask)
-#elif OS_TASK_COUNT <= 16U
-    typedef uint16_t os_task_mask_t;
-    #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK16(mask)
-#elif OS_TASK_COUNT <= 32U
-    typedef uint32_t os_task_mask_t;
-    #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask)
-#elif OS_TASK_COUNT <= 64U
-    typedef uint64_t os_task_mask_t;
-    #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK(mask) OS_GET_HIGHEST_PRIO_TASK_FROM_MASK64(mask)
+#if (BEERTOS_USE_TASK_POOL == true)
+#undef OS_STACK_CLASS
+#define OS_STACK_CLASS(name, stack, count) +(count)
+
+/*! Number of pool slots (stacks and task control blocks) of all stack classes */
+enum
+{
+    OS_TASK_POOL_SLOT_COUNT = 0U BEERTOS_TASK_POOL_LIST()
+};
+
+#undef OS_STACK_CLASS
+#define OS_STACK_CLASS(name, ...) name,
+
+/*! Stack classes of the task pool - generated from BEERTOS_TASK_POOL_LIST() in BeeRTOS_cfg.h */
+typedef enum
+{
+    BEERTOS_TASK_POOL_LIST()
+    OS_STACK_CLASS_MAX
+} os_stack_class_t;
+#endif
+
+/******************************************************************************************/
+
+/*! Priority type, wide enough for all configured tasks */
+#if OS_TASK_COUNT <= 256U
+    typedef uint8_t os_task_prio_t;
 #else
-    #error "OS_TASK_MAX must be less or equal to 64"
+    typedef uint16_t os_task_prio_t;
+#endif
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+/*! Configuration of a basic task, generated from BEERTOS_BASIC_TASK */
+typedef struct
+{
+    os_task_handler handler; /* task function, runs to completion */
+    void *argv;              /* argument of the task function */
+    uint32_t stack_size;     /* bytes of the shared stack used by the task */
+    os_task_id_t id;         /* priority level of the task */
+} os_task_basic_cfg_t;
+#endif
+
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+typedef void (*os_task_periodic_handler)(void);
+
+/*! Response time statistics of a periodic task, in ticks from the release of a job */
+typedef struct
+{
+    uint32_t jobs;          /* completed jobs */
+    uint32_t misses;        /* jobs completed at or after their deadline */
+    uint32_t response_max;  /* worst-case response time */
+    uint32_t response_mean; /* mean response time, rounded down */
+    uint32_t response_last; /* response time of the last job */
+} os_task_periodic_stats_t;
+
+/*! Configuration and statistics of a periodic task, generated from BEERTOS_PERIODIC_TASK */
+typedef struct
+{
+    os_task_periodic_handler handler; /* job function, called once per period */
+    uint32_t period;                  /* ticks between the releases */
+    uint32_t offset;                  /* tick of the first release */
+    uint32_t deadline;                /* relative deadline in ticks */
+    os_task_id_t id;                  /* task running the jobs */
+    uint32_t jobs;
+    uint32_t misses;
+    uint32_t response_max;
+    uint32_t response_last;
+    uint64_t response_sum;            /* sum of the response times, for the mean */
+} os_task_periodic_t;
 #endif
 
+/*! OS Thread control block */
+typedef struct os_task
+{
+    volatile void *sp;       /*!< stack pointer */
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+    uint32_t stack_guard;    /*!< base of the stack guard, must follow sp (used by PendSV_Handler) */
+#endif
+    uint32_t ticks;          /*!< ticks (relative to the previous delayed task if BEERTOS_USE_DELAY_LIST) */
+    os_task_prio_t priority; /*!< priority */
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    os_task_prio_t preempt_threshold;  /*!< only tasks above this priority preempt the task once it was dispatched */
+    struct os_task *threshold_prev;    /*!< dispatched threshold task below this one */
+#endif
+#if (BEERTOS_USE_EDF == true)
+    uint32_t edf_deadline;             /*!< relative deadline in ticks, 0 for tasks scheduled by priority */
+    uint32_t edf_abs_deadline;         /*!< absolute deadline (tick) set when the task becomes ready */
+    os_task_prio_t edf_index;          /*!< position in the deadline heap while ready */
+#endif
+#if (BEERTOS_USE_DELAY_LIST == true)
+    struct os_task *delay_next; /*!< next task in the delay list */
+    struct os_task *delay_prev; /*!< previous task in the delay list */
+#endif
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    uint64_t runtime;           /*!< CPU time in port timestamp units */
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    uint32_t release_timestamp; /*!< timestamp of the last release, valid if release_pending */
+    bool release_pending;       /*!< released, but not switched in yet */
+    os_task_latency_t latency;  /*!< wakeup latency statistics */
+#endif
+#if (BEERTOS_USE_TRACE_RECORDER == true)
+    uint16_t trace_id;          /*!< task ID in the trace records, set by os_trace_task_create */
+#endif
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    uint32_t notify_value;      /*!< notification value */
+    uint8_t notify_state;       /*!< notification state (os_task_notify_state_t) */
+#endif
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    const os_task_basic_cfg_t *basic; /*!< configuration of a basic task, NULL for other tasks */
+    os_stack_t *basic_stack;          /*!< part of the shared stack used while dispatched */
+    uint8_t basic_state;              /*!< state of a basic task (OS_TASK_BASIC_*) */
+#endif
+#if (BEERTOS_WDG_MODULE_EN == true)
+    os_task_prio_t wdg_slot;          /*!< watchdog entry of the task + 1, 0 if not registered */
+#endif
+} os_task_t;
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/*! Slot of the task pool - task control block and stack of one dynamic task */
+typedef struct os_task_pool_slot
+{
+    os_task_t control;                   /* must be the first member, the TCB identifies the slot */
+    os_stack_t *stack;                   /* stack of the slot */
+    uint32_t stack_size;                 /* stack size in bytes */
+    struct os_task_pool_slot *next_free; /* next free slot of the same stack class */
+    os_stack_class_t stack_class;        /* stack class of the slot */
+} os_task_pool_slot_t;
+#endif
+
+/*! Actions applied to the notification value by os_task_notify() */
+typedef enum
+{
+    OS_TASK_NOTIFY_SET_BITS = 0,  /* value |= bits, used as event flags */
+    OS_TASK_NOTIFY_INCREMENT,     /* value++, used as a counting semaphore, bits are ignored */
+    OS_TASK_NOTIFY_OVERWRITE,     /* value = bits, even if the previous value was not taken */
+    OS_TASK_NOTIFY_NO_OVERWRITE,  /* value = bits, fails if the previous value was not taken */
+} os_task_notify_action_t;
+
+/*! Stack usage of a task in bytes, used + free is the size of the stack */
+typedef struct
+{
+    uint32_t size; /* size of the stack, 0 for mutex slots and basic tasks */
+    uint32_t used; /* high-water mark - the most bytes ever used */
+    uint32_t free; /* bytes never used since the task was created */
+} os_task_stack_usage_t;
+
+/*! Task masks (os_task_mask_t) and the bitmap API, selected by OS_TASK_COUNT */
+#include "BeeRTOS_bitmap.h"
+
 /******************************************************************************************
  *                                    GLOBAL VARIABLES                                    *
  ******************************************************************************************/
 
+/*! Set when the scheduler has to be run (internal, see os_leave_critical_section) */
+extern volatile bool os_sched_pending;
+
 /******************************************************************************************
  *                                   FUNCTION PROTOTYPES                                  *
  ******************************************************************************************/
 void os_task_module_init(void);
 bool os_task_start(const os_task_id_t task_id);
+bool os_task_start_from_isr(const os_task_id_t task_id, bool *const task_woken);
 bool os_task_stop(const os_task_id_t task_id);
 void os_task_release(const os_task_id_t task_id);
 void os_task_delete(void);
+#if (BEERTOS_USE_TASK_POOL == true)
+bool os_task_create_dynamic(const os_task_handler task_handler,
+                            void *const argv,
+                            const os_stack_class_t stack_class,
+                            const os_task_id_t id);
+#endif
+#if (BEERTOS_USE_BASIC_TASKS == true)
+uint32_t os_task_get_basic_stack_peak(void);
+#endif
 void os_delay(const uint32_t ticks);
+bool os_delay_until(uint32_t *const last_wake_time, const uint32_t period);
 void os_task_tick(void);
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+void os_task_tick_compensate(const uint32_t ticks);
+#endif
+uint32_t os_task_get_next_wakeup(void);
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+bool os_task_notify(const os_task_id_t id, const uint32_t bits, const os_task_notify_action_t action);
+bool os_task_notify_from_isr(const os_task_id_t id,
+                             const uint32_t bits,
+                             const os_task_notify_action_t action,
+                             bool *const task_woken);
+bool os_task_notify_wait(const uint32_t clear_mask, uint32_t *const value, const uint32_t timeout);
+#endif
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+os_task_stack_usage_t os_task_get_stack_high_water(const os_task_id_t id);
+void os_task_get_stack_report(os_task_stack_usage_t report[OS_TASK_MAX]);
+#endif
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+void os_task_runtime_update(void);
+uint64_t os_task_get_runtime(const os_task_id_t id);
+uint32_t os_get_cpu_load(void);
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+void os_isr_enter(void);
+void os_isr_exit(void);
+void os_task_latency_update(void);
+bool os_task_get_latency(const os_task_id_t id, os_task_latency_t *const latency);
+void os_task_reset_latency(const os_task_id_t id);
+#else
+/* Interrupt entry/exit hooks are only needed by the latency measurement */
+static inline void os_isr_enter(void) {}
+static inline void os_isr_exit(void) {}
+#endif
+#if (BEERTOS_USE_PERIODIC_TASKS == true)
+bool os_task_get_periodic_stats(const os_task_id_t id, os_task_periodic_stats_t *const stats);
+void os_task_reset_periodic_stats(const os_task_id_t id);
+#endif
+bool os_task_higher_priority_ready(void);
 void os_sched(void);
+void os_sched_process(void);
 
 #endif /* __BEERTOS_TASK_H__ */
\ No newline at end of file
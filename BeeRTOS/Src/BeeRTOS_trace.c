@@ -0,0 +1,121 @@
+/******************************************************************************************
+ * @brief Source file for the BeeRTOS trace recorder
+ * @file BeeRTOS_trace.c
+ * This file implements the native trace recorder. Records are written into a ring buffer
+ * without a critical section - the slot is reserved by an atomic increment of the head,
+ * so interrupts of any priority can record at the same time. When the buffer is full, the
+ * oldest records are overwritten, the buffer always holds the latest history (e.g. for a
+ * crash dump).
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#include "BeeRTOS_trace_cfg.h"
+
+#if (BEERTOS_USE_TRACE_RECORDER == true)
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+#if ((BEERTOS_TRACE_BUFFER_SIZE & (BEERTOS_TRACE_BUFFER_SIZE - 1U)) != 0U) || (BEERTOS_TRACE_BUFFER_SIZE == 0U)
+#error "BEERTOS_TRACE_BUFFER_SIZE must be a power of 2"
+#endif
+
+#define OS_TRACE_INDEX_MASK (BEERTOS_TRACE_BUFFER_SIZE - 1U)
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        VARIABLES                                       *
+ ******************************************************************************************/
+
+/*! The header is initialized statically, tasks are created (and traced) before os_init
+ *  initializes the modules */
+os_trace_buffer_t os_trace_buffer = {
+    .magic = OS_TRACE_MAGIC,
+    .version = OS_TRACE_VERSION,
+    .record_size = sizeof(os_trace_record_t),
+    .capacity = BEERTOS_TRACE_BUFFER_SIZE,
+    .timestamp_hz = BEERTOS_TRACE_TIMESTAMP_HZ,
+    .task_count = OS_TASK_MAX,
+    .name_length = BEERTOS_TRACE_NAME_LENGTH,
+    .head = 0U,
+};
+
+/******************************************************************************************
+ *                                        FUNCTIONS                                       *
+ ******************************************************************************************/
+
+/**
+ * @brief Write one record into the trace buffer. Can be called from any context, including
+ * interrupts above BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * @param event - event ID
+ * @param id - task or object ID
+ * @param arg - event argument
+ * @return None
+ */
+void os_trace_record(const os_trace_event_t event, const uint16_t id, const uint32_t arg)
+{
+    const uint32_t timestamp = os_port_get_timestamp();
+    const uint32_t index = __atomic_fetch_add(&os_trace_buffer.head, 1U, __ATOMIC_RELAXED);
+    os_trace_record_t *const record = &os_trace_buffer.records[index & OS_TRACE_INDEX_MASK];
+
+    record->timestamp = timestamp;
+    record->arg = arg;
+    record->id = id;
+    record->event = (uint8_t)event;
+    __atomic_store_n(&record->lap, (uint8_t)((index / BEERTOS_TRACE_BUFFER_SIZE) + 1U), __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Write a task event into the trace buffer. The task is identified by the ID of its
+ * own priority level, also while it runs with the priority of a mutex.
+ *
+ * @param event - event ID
+ * @param task - task control block, the event is dropped if NULL
+ * @param arg - event argument
+ * @return None
+ */
+void os_trace_task(const os_trace_event_t event, os_task_t *const task, const uint32_t arg)
+{
+    if (NULL != task)
+    {
+        os_trace_record(event, task->trace_id, arg);
+    }
+}
+
+/**
+ * @brief Record the creation of a task and store its name for the decoder.
+ * Called for every task during os_init, before the task can run.
+ *
+ * @param task - task control block
+ * @param name - task name, truncated to BEERTOS_TRACE_NAME_LENGTH - 1 characters
+ * @param stack_size - stack size in bytes
+ * @return None
+ */
+void os_trace_task_create(os_task_t *const task, const char *const name, const uint32_t stack_size)
+{
+    const uint16_t id = (0U == task->priority) ? (uint16_t)OS_TASK_IDLE
+                                               : (uint16_t)OS_GET_TASK_ID_FROM_PRIORITY(task->priority);
+    char *const task_name = os_trace_buffer.task_names[id];
+    uint32_t i = 0U;
+
+    task->trace_id = id;
+
+    for (; (i < (BEERTOS_TRACE_NAME_LENGTH - 1U)) && ('\0' != name[i]); i++)
+    {
+        task_name[i] = name[i];
+    }
+    task_name[i] = '\0';
+
+    os_trace_record(OS_TRACE_EVENT_TASK_CREATE, id, stack_size);
+}
+
+#endif /* BEERTOS_USE_TRACE_RECORDER */
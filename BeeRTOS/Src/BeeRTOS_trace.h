@@ -0,0 +1,127 @@
+/******************************************************************************************
+ * @brief Header file for the BeeRTOS trace recorder
+ * @file BeeRTOS_trace.h
+ * This header file defines the native trace recorder of BeeRTOS, an alternative to the
+ * SEGGER SystemView backend. Kernel events are stored as fixed-size binary records with a
+ * port timestamp in a RAM ring buffer (os_trace_buffer), which is self-describing, so a RAM
+ * dump can be converted to a Chrome/Perfetto trace by Tools/trace_decode.py. Including this
+ * header from BeeRTOS_trace_cfg.h defines all the BEERTOS_TRACE_* hooks.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_TRACE_H__
+#define __BEERTOS_TRACE_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/*! "BTRC" - marks the start of os_trace_buffer in a RAM dump */
+#define OS_TRACE_MAGIC (0x43525442U)
+/*! Incremented with every change of the buffer layout or of the event IDs */
+#define OS_TRACE_VERSION (1U)
+
+#define BEERTOS_TRACE_INIT() {}
+#define BEERTOS_TRACE_TICK(ticks) (void)ticks;
+#define BEERTOS_TRACE_TASK_CREATE(task, name, stack_size) os_trace_task_create(task, name, stack_size)
+#define BEERTOS_TRACE_TASK_SWITCHED(task) os_trace_task(OS_TRACE_EVENT_TASK_SWITCHED, task, 0U)
+#define BEERTOS_TRACE_TASK_READY(task) os_trace_task(OS_TRACE_EVENT_TASK_READY, task, 0U)
+#define BEERTOS_TRACE_TASK_DELAYED(task) os_trace_task(OS_TRACE_EVENT_TASK_DELAYED, task, 0U)
+#define BEERTOS_TRACE_SEMAPHORE_BLOCKED(task) os_trace_task(OS_TRACE_EVENT_SEMAPHORE_BLOCKED, task, 0U)
+#define BEERTOS_TRACE_SEMAPHORE_UNBLOCKED(task) os_trace_task(OS_TRACE_EVENT_SEMAPHORE_UNBLOCKED, task, 0U)
+#define BEERTOS_TRACE_MESSAGE_BLOCKED(task) os_trace_task(OS_TRACE_EVENT_MESSAGE_BLOCKED, task, 0U)
+#define BEERTOS_TRACE_MESSAGE_UNBLOCKED(task) os_trace_task(OS_TRACE_EVENT_MESSAGE_UNBLOCKED, task, 0U)
+#define BEERTOS_TRACE_MUTEX_BLOCKED(task) os_trace_task(OS_TRACE_EVENT_MUTEX_BLOCKED, task, 0U)
+#define BEERTOS_TRACE_MUTEX_UNBLOCKED(task) os_trace_task(OS_TRACE_EVENT_MUTEX_UNBLOCKED, task, 0U)
+#define BEERTOS_TRACE_EVENT_BLOCKED(task) os_trace_task(OS_TRACE_EVENT_EVENT_BLOCKED, task, 0U)
+#define BEERTOS_TRACE_EVENT_UNBLOCKED(task) os_trace_task(OS_TRACE_EVENT_EVENT_UNBLOCKED, task, 0U)
+#define BEERTOS_TRACE_MUTEX_PRIORITY_INHERITANCE(task, priority) \
+    os_trace_task(OS_TRACE_EVENT_PRIORITY_INHERITANCE, task, (uint32_t)(priority))
+#define BEERTOS_TRACE_MUTEX_PRIORITY_RESTORE(task, priority) \
+    os_trace_task(OS_TRACE_EVENT_PRIORITY_RESTORE, task, (uint32_t)(priority))
+#define BEERTOS_TRACE_EXIT_ISR_SCHEDULER() os_trace_record(OS_TRACE_EVENT_ISR_EXIT_TO_SCHEDULER, 0U, 0U)
+#define BEERTOS_TRACE_ENTER_ISR() os_trace_record(OS_TRACE_EVENT_ISR_ENTER, 0U, 0U)
+#define BEERTOS_TRACE_EXIT_ISR() os_trace_record(OS_TRACE_EVENT_ISR_EXIT, 0U, 0U)
+#define BEERTOS_TRACE_ALARM_START(alarm_id, period, periodic)                                    \
+    os_trace_record((periodic) ? OS_TRACE_EVENT_ALARM_START_PERIODIC : OS_TRACE_EVENT_ALARM_START, \
+                    (uint16_t)(alarm_id), (uint32_t)(period))
+#define BEERTOS_TRACE_ALARM_CANCEL(alarm_id) os_trace_record(OS_TRACE_EVENT_ALARM_CANCEL, (uint16_t)(alarm_id), 0U)
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/*! Trace event IDs, the ID of the record is a task ID unless stated otherwise */
+typedef enum
+{
+    OS_TRACE_EVENT_NONE = 0,              /* never written */
+    OS_TRACE_EVENT_TASK_CREATE,           /* arg: stack size */
+    OS_TRACE_EVENT_TASK_SWITCHED,
+    OS_TRACE_EVENT_TASK_READY,
+    OS_TRACE_EVENT_TASK_DELAYED,
+    OS_TRACE_EVENT_SEMAPHORE_BLOCKED,
+    OS_TRACE_EVENT_SEMAPHORE_UNBLOCKED,
+    OS_TRACE_EVENT_MESSAGE_BLOCKED,
+    OS_TRACE_EVENT_MESSAGE_UNBLOCKED,
+    OS_TRACE_EVENT_MUTEX_BLOCKED,
+    OS_TRACE_EVENT_MUTEX_UNBLOCKED,
+    OS_TRACE_EVENT_EVENT_BLOCKED,
+    OS_TRACE_EVENT_EVENT_UNBLOCKED,
+    OS_TRACE_EVENT_PRIORITY_INHERITANCE,  /* arg: new priority */
+    OS_TRACE_EVENT_PRIORITY_RESTORE,      /* arg: restored priority */
+    OS_TRACE_EVENT_ISR_ENTER,             /* no ID */
+    OS_TRACE_EVENT_ISR_EXIT,              /* no ID */
+    OS_TRACE_EVENT_ISR_EXIT_TO_SCHEDULER, /* no ID */
+    OS_TRACE_EVENT_ALARM_START,           /* ID: alarm, arg: period in ticks */
+    OS_TRACE_EVENT_ALARM_START_PERIODIC,  /* ID: alarm, arg: period in ticks */
+    OS_TRACE_EVENT_ALARM_CANCEL,          /* ID: alarm */
+    OS_TRACE_EVENT_MAX
+} os_trace_event_t;
+
+/*! Single trace record (12 bytes) */
+typedef struct
+{
+    uint32_t timestamp; /* port timestamp, see os_port_get_timestamp */
+    uint32_t arg;       /* event argument */
+    uint16_t id;        /* task or object ID */
+    uint8_t event;      /* os_trace_event_t */
+    uint8_t lap;        /* (index / BEERTOS_TRACE_BUFFER_SIZE + 1) mod 256 - written last,
+                           identifies records not written completely when the RAM was dumped */
+} os_trace_record_t;
+
+/*! Trace buffer, the header describes the layout for the decoder */
+typedef struct
+{
+    uint32_t magic;         /* OS_TRACE_MAGIC */
+    uint16_t version;       /* OS_TRACE_VERSION */
+    uint16_t record_size;   /* sizeof(os_trace_record_t) */
+    uint32_t capacity;      /* BEERTOS_TRACE_BUFFER_SIZE */
+    uint32_t timestamp_hz;  /* BEERTOS_TRACE_TIMESTAMP_HZ, 0 if unknown */
+    uint16_t task_count;    /* OS_TASK_MAX */
+    uint16_t name_length;   /* BEERTOS_TRACE_NAME_LENGTH */
+    volatile uint32_t head; /* number of records written so far, free running */
+    char task_names[OS_TASK_MAX][BEERTOS_TRACE_NAME_LENGTH]; /* indexed by task ID */
+    os_trace_record_t records[BEERTOS_TRACE_BUFFER_SIZE];    /* record n is at n % capacity */
+} os_trace_buffer_t;
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/*! Not static, so it can be dumped by its symbol (e.g. from gdb) */
+extern os_trace_buffer_t os_trace_buffer;
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+void os_trace_record(const os_trace_event_t event, const uint16_t id, const uint32_t arg);
+void os_trace_task(const os_trace_event_t event, os_task_t *const task, const uint32_t arg);
+void os_trace_task_create(os_task_t *const task, const char *const name, const uint32_t stack_size);
+
+#endif /* __BEERTOS_TRACE_H__ */
@@ -0,0 +1,319 @@
+/******************************************************************************************
+ * @brief Source file for the BeeRTOS task liveness watchdog
+ * @file BeeRTOS_wdg.c
+ * This file implements the task liveness watchdog. Each registered task has a check-in
+ * deadline, moved by os_wdg_kick() one period ahead. The system tick only compares the tick
+ * counter with a lower bound of all the deadlines, so the check costs O(1) per tick - the
+ * registered tasks are scanned only when the bound is reached, which is at most once per the
+ * shortest check-in period while all tasks check in. A task that misses its deadline is
+ * reported by BEERTOS_WDG_MISS_CB and the hardware watchdog is no longer fed by the tick.
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#include "BeeRTOS_wdg.h"
+#include "BeeRTOS_assert.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        VARIABLES                                       *
+ ******************************************************************************************/
+
+#if (BEERTOS_WDG_MODULE_EN == true)
+
+extern os_task_t *volatile os_task_current;
+
+/*! Registered tasks, the first os_wdg_count entries are used */
+static os_wdg_entry_t os_wdg_entries[OS_TASK_MAX];
+static uint32_t os_wdg_count;
+/*! Number of registered tasks which missed their check-in */
+static uint32_t os_wdg_expired_count;
+/*! No deadline of a task which did not miss its check-in is before this tick */
+static uint32_t os_wdg_next_check;
+
+/******************************************************************************************
+ *                                        FUNCTIONS                                       *
+ ******************************************************************************************/
+
+/**
+ * @brief Returns true if the deadline has passed, correct also after the tick counter wraparound.
+ * A check-in exactly at the deadline tick is in time.
+ *
+ * @param deadline - tick of the latest allowed check-in
+ * @param now - current tick
+ * @return true if the deadline has passed
+ */
+static inline bool os_wdg_passed(const uint32_t deadline, const uint32_t now)
+{
+    return ((int32_t)(now - deadline) > 0);
+}
+
+/**
+ * @brief Keeps os_wdg_next_check a lower bound of the deadlines, called before a task with
+ * the given deadline starts to be checked (registered or checked in after a miss).
+ *
+ * @param deadline - deadline of the task
+ * @return None
+ */
+static inline void os_wdg_arm(const uint32_t deadline)
+{
+    if ((os_wdg_count == os_wdg_expired_count) || ((int32_t)(deadline - os_wdg_next_check) < 0))
+    {
+        os_wdg_next_check = deadline;
+    }
+}
+
+/**
+ * @brief Moves the deadline of the task, a task which missed its check-in is checked again.
+ *
+ * @param entry - entry of the task
+ * @param deadline - new deadline of the task
+ * @return None
+ */
+static void os_wdg_check_in(os_wdg_entry_t *const entry, const uint32_t deadline)
+{
+    if (entry->expired)
+    {
+        os_wdg_arm(deadline);
+        entry->expired = false;
+        os_wdg_expired_count--;
+    }
+    entry->deadline = deadline;
+}
+
+/**
+ * @brief Scans the registered tasks, reports the tasks whose deadline has passed and
+ * computes the next tick when the tasks have to be scanned.
+ *
+ * @param now - current tick
+ * @return None
+ */
+static void os_wdg_check(const uint32_t now)
+{
+    bool armed = false;
+
+    for (uint32_t i = 0U; i < os_wdg_count; i++)
+    {
+        os_wdg_entry_t *const entry = &os_wdg_entries[i];
+
+        if (entry->expired)
+        {
+            continue;
+        }
+
+        if (os_wdg_passed(entry->deadline, now))
+        {
+            entry->expired = true;
+            os_wdg_expired_count++;
+            BEERTOS_WDG_MISS_CB(entry->id);
+        }
+        else if (!armed || ((int32_t)(entry->deadline - os_wdg_next_check) < 0))
+        {
+            os_wdg_next_check = entry->deadline;
+            armed = true;
+        }
+        else
+        {
+            /* A later deadline */
+        }
+    }
+}
+
+/**
+ * @brief The function initializes the watchdog, no task is registered.
+ * Called once (automatically) in os system initialization.
+ *
+ * @param None
+ * @return None
+ */
+void os_wdg_module_init(void)
+{
+    os_wdg_count = 0U;
+    os_wdg_expired_count = 0U;
+    os_wdg_next_check = 0U;
+}
+
+/**
+ * @brief Register the calling task with the watchdog, the task has to call os_wdg_kick()
+ * at least once per period from now on. Registering again changes the period and counts
+ * as a check-in. Must be called before the task locks any mutex (the id of the task is
+ * taken from its priority).
+ *
+ * @param period - check-in period in ticks, must be > 0
+ * @return None
+ */
+void os_wdg_register(const uint32_t period)
+{
+    BEERTOS_ASSERT(period > 0U, OS_MODULE_ID_WDG, OS_ERROR_INVALID_PARAM);
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_t *const task = os_task_current;
+    const uint32_t deadline = os_get_tick_count() + period;
+
+    if (0U == task->wdg_slot)
+    {
+        os_wdg_entry_t *const entry = &os_wdg_entries[os_wdg_count];
+
+        os_wdg_arm(deadline);
+        entry->task = task;
+        entry->period = period;
+        entry->deadline = deadline;
+        entry->id = OS_GET_TASK_ID_FROM_PRIORITY(task->priority);
+        entry->expired = false;
+
+        os_wdg_count++;
+        task->wdg_slot = (os_task_prio_t)os_wdg_count;
+    }
+    else
+    {
+        os_wdg_entry_t *const entry = &os_wdg_entries[task->wdg_slot - 1U];
+
+        /* The period can be shorter than before */
+        if (!entry->expired)
+        {
+            os_wdg_arm(deadline);
+        }
+        entry->period = period;
+        os_wdg_check_in(entry, deadline);
+    }
+
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief Unregister the calling task from the watchdog, e.g. before it waits without a timeout
+ * on purpose or stops itself. Does nothing if the task is not registered.
+ *
+ * @param None
+ * @return None
+ */
+void os_wdg_unregister(void)
+{
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_task_t *const task = os_task_current;
+
+    if (task->wdg_slot > 0U)
+    {
+        os_wdg_entry_t *const entry = &os_wdg_entries[task->wdg_slot - 1U];
+
+        if (entry->expired)
+        {
+            os_wdg_expired_count--;
+        }
+
+        /* The last entry takes the place of the removed one */
+        *entry = os_wdg_entries[os_wdg_count - 1U];
+        entry->task->wdg_slot = task->wdg_slot;
+        os_wdg_count--;
+        task->wdg_slot = 0U;
+    }
+
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief Check-in of the calling task - its deadline is moved one period ahead. A task which
+ * missed its check-in is checked again. Constant time, the task must be registered.
+ *
+ * @param None
+ * @return None
+ */
+void os_wdg_kick(void)
+{
+    BEERTOS_ASSERT(os_task_current->wdg_slot > 0U, OS_MODULE_ID_WDG, OS_ERROR_INVALID_STATE);
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    os_wdg_entry_t *const entry = &os_wdg_entries[os_task_current->wdg_slot - 1U];
+    os_wdg_check_in(entry, os_get_tick_count() + entry->period);
+
+    os_leave_critical_section(crit_state);
+}
+
+/**
+ * @brief Returns true if the task is registered and missed its check-in (and did not check
+ * in since then).
+ *
+ * @param id - id of the task
+ * @return true if the task missed its check-in
+ */
+bool os_wdg_is_expired(const os_task_id_t id)
+{
+    bool expired = false;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+
+    for (uint32_t i = 0U; i < os_wdg_count; i++)
+    {
+        if (id == os_wdg_entries[i].id)
+        {
+            expired = os_wdg_entries[i].expired;
+        }
+    }
+
+    os_leave_critical_section(crit_state);
+
+    return expired;
+}
+
+/**
+ * @brief Process one system tick, called by os_tick after the tick counter is incremented.
+ * Tasks which missed their check-in are reported by BEERTOS_WDG_MISS_CB (in the tick
+ * interrupt), the hardware watchdog is fed by BEERTOS_WDG_FEED only if no registered task
+ * missed its check-in.
+ *
+ * @param None
+ * @return None
+ */
+void os_wdg_tick(void)
+{
+    const uint32_t now = os_get_tick_count();
+
+    if ((os_wdg_count > os_wdg_expired_count) && os_wdg_passed(os_wdg_next_check, now))
+    {
+        os_wdg_check(now);
+    }
+
+    if (0U == os_wdg_expired_count)
+    {
+        BEERTOS_WDG_FEED();
+    }
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/**
+ * @brief This function returns the number of ticks until the tick which scans the registered
+ * tasks - a task missing its deadline is found on the tick after the deadline. The tickless
+ * idle mode does not sleep past it, so the miss is reported in time.
+ * Must be called with interrupts disabled.
+ *
+ * @param None
+ * @return UINT32_MAX if no registered task can miss its check-in, otherwise the number of ticks
+ */
+uint32_t os_wdg_get_next_check(void)
+{
+    uint32_t next_check = UINT32_MAX;
+
+    if (os_wdg_count > os_wdg_expired_count)
+    {
+        const int32_t ticks = (int32_t)(os_wdg_next_check - os_get_tick_count());
+
+        next_check = (ticks >= 0) ? ((uint32_t)ticks + 1U) : 0U;
+    }
+
+    return next_check;
+}
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
+#endif /* BEERTOS_WDG_MODULE_EN */
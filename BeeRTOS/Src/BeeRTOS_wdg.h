@@ -0,0 +1,57 @@
+/******************************************************************************************
+ * @brief Header file for the BeeRTOS task liveness watchdog
+ * @file BeeRTOS_wdg.h
+ * This header file defines the interface of the task liveness watchdog. A task registers
+ * itself with a check-in period and has to call os_wdg_kick() at least once per period.
+ * The check is done by the system tick - when a registered task misses its check-in,
+ * BEERTOS_WDG_MISS_CB is called and the hardware watchdog is no longer fed by the tick
+ * (BEERTOS_WDG_FEED), until the task checks in again or is unregistered.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_WDG_H__
+#define __BEERTOS_WDG_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS_internal.h"
+#include "BeeRTOS_task.h"
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/*! Registered task, the task control block holds the index of its entry */
+typedef struct
+{
+    os_task_t *task;
+    uint32_t period;      /* check-in period in ticks */
+    uint32_t deadline;    /* tick of the latest allowed check-in */
+    os_task_id_t id;      /* id of the task when it was registered, passed to BEERTOS_WDG_MISS_CB */
+    bool expired;         /* the deadline was missed, reported by BEERTOS_WDG_MISS_CB */
+} os_wdg_entry_t;
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+void os_wdg_module_init(void);
+void os_wdg_register(const uint32_t period);
+void os_wdg_unregister(void);
+void os_wdg_kick(void);
+bool os_wdg_is_expired(const os_task_id_t id);
+void os_wdg_tick(void);
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+uint32_t os_wdg_get_next_check(void);
+#endif
+
+#endif /* __BEERTOS_WDG_H__ */
@@ -4,8 +4,11 @@
  * This header file defines the portable layer's interface for BeeRTOS, providing essential
  * utilities and definitions that abstract architecture-specific details, ensuring the kernel
  * can operate across different hardware platforms. It includes macros for computing the
- * highest priority task from a set of tasks, based on their ready states, and defines the
- * stack type used by the tasks.
+ * highest priority task from a set of tasks, based on their ready states, defines the
+ * stack type used by the tasks and implements the critical section primitives inline.
+ * With BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0 the critical sections raise BASEPRI,
+ * so interrupts with a higher priority are never masked by the kernel, otherwise PRIMASK
+ * is used and all interrupts are masked.
  ******************************************************************************************/
 
 #ifndef __OS_PORTABLE_H__
@@ -26,12 +29,19 @@
 #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask) (32 - __builtin_clz(mask))
 #define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK64(mask) (64 - __builtin_clzll(mask))
 
+/*! Size of the MPU stack guard region (the smallest MPU region of ARMv7-M) */
+#define OS_PORT_STACK_GUARD_SIZE (32U)
+
 /******************************************************************************************
  *                                        TYPEDEFS                                        *
  ******************************************************************************************/
 
 typedef uint32_t os_stack_t;
 
+/*! Interrupt mask state saved when a critical section is entered (BASEPRI or PRIMASK),
+ *  0 if the kernel interrupts were not masked */
+typedef uint32_t os_crit_state_t;
+
 /******************************************************************************************
  *                                    GLOBAL VARIABLES                                    *
  ******************************************************************************************/
@@ -40,4 +50,64 @@ typedef uint32_t os_stack_t;
  *                                   FUNCTION PROTOTYPES                                  *
  ******************************************************************************************/
 
+#if (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0U)
+static inline os_crit_state_t os_port_enter_critical(void)
+{
+    os_crit_state_t state;
+    const uint32_t basepri = BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY;
+
+    /* BASEPRI_MAX never lowers the current masking level */
+    __asm volatile
+    (
+        "mrs    %0, basepri         \n"
+        "msr    basepri_max, %1     \n"
+        "isb                        \n"
+        "dsb                        \n"
+        : "=&r" (state) : "r" (basepri) : "memory"
+    );
+
+    return state;
+}
+
+static inline void os_port_leave_critical(const os_crit_state_t state)
+{
+    __asm volatile
+    (
+        "msr    basepri, %0         \n"
+        : : "r" (state) : "memory"
+    );
+}
+#else
+static inline os_crit_state_t os_port_enter_critical(void)
+{
+    os_crit_state_t state;
+
+    __asm volatile
+    (
+        "mrs    %0, primask         \n"
+        "cpsid  i                   \n"
+        : "=r" (state) : : "memory"
+    );
+
+    return state;
+}
+
+static inline void os_port_leave_critical(const os_crit_state_t state)
+{
+    __asm volatile
+    (
+        "msr    primask, %0         \n"
+        : : "r" (state) : "memory"
+    );
+}
+#endif /* BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY */
+
+void os_port_yield_from_isr(const bool task_woken);
+
+/* Free-running timestamp (runtime statistics, benchmarks) - DWT cycle counter, enabled by os_cpu_init */
+static inline uint32_t os_port_get_timestamp(void)
+{
+    return *((volatile uint32_t *)0xE0001004U);
+}
+
 #endif /* __OS_PORTABLE_H__ */
\ No newline at end of file
@@ -28,13 +28,44 @@
 
 #define PORT_NVIC_INT_CTRL                  (*((volatile uint32_t *)0xE000ED04U))
 #define PORT_NVIC_PENDSV_SET_MSK            (1UL << 28U)
+#define PORT_NVIC_PENDSTSET_MSK             (1UL << 26U)
+
+/* SysTick control register bits */
+#define PORT_NVIC_SYSTICK_ENABLE_MSK        (1UL << 0U)
+#define PORT_NVIC_SYSTICK_COUNTFLAG_MSK     (1UL << 16U)
+#define PORT_NVIC_SYSTICK_MAX_RELOAD        (0x00FFFFFFUL)
+
+/* DWT cycle counter registers and bits */
+#define PORT_DCB_DEMCR                      (*((volatile uint32_t *)0xE000EDFCU))
+#define PORT_DCB_DEMCR_TRCENA_MSK           (1UL << 24U)
+#define PORT_DWT_CTRL                       (*((volatile uint32_t *)0xE0001000U))
+#define PORT_DWT_CYCCNT                     (*((volatile uint32_t *)0xE0001004U))
+#define PORT_DWT_CTRL_CYCCNTENA_MSK         (1UL << 0U)
+
+/* MPU registers and bits */
+#define PORT_SCB_SHCSR                      (*((volatile uint32_t *)0xE000ED24U))
+#define PORT_SCB_SHCSR_MEMFAULTENA_MSK      (1UL << 16U)
+#define PORT_MPU_CTRL                       (*((volatile uint32_t *)0xE000ED94U))
+#define PORT_MPU_RNR                        (*((volatile uint32_t *)0xE000ED98U))
+#define PORT_MPU_RBAR                       (*((volatile uint32_t *)0xE000ED9CU))
+#define PORT_MPU_RASR                       (*((volatile uint32_t *)0xE000EDA0U))
+#define PORT_MPU_CTRL_ENABLE_MSK            (1UL << 0U)
+#define PORT_MPU_CTRL_PRIVDEFENA_MSK        (1UL << 2U)
+#define PORT_MPU_RBAR_VALID_MSK             (1UL << 4U)
+/* No access, execute never, normal memory (S, C), size 2^(4+1) = OS_PORT_STACK_GUARD_SIZE */
+#define PORT_MPU_RASR_STACK_GUARD           ((1UL << 28U) | (1UL << 18U) | (1UL << 17U) | (4UL << 1U) | 1UL)
 
 /* Interrupt priority mask */
 #define PORT_LOWEST_INTERRUPT_PRIORITY      (0xFFU)
 #define PORT_HIGHEST_INTERRUPT_PRIORITY     (0x00U)
 
 #define PORT_NVIC_PENDSV_PRI                (PORT_LOWEST_INTERRUPT_PRIORITY << 16U)
+#if (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0U)
+/* SysTick calls the kernel, so it must not preempt the BASEPRI critical sections */
+#define PORT_NVIC_SYSTICK_PRI               (PORT_LOWEST_INTERRUPT_PRIORITY << 24U)
+#else
 #define PORT_NVIC_SYSTICK_PRI               (PORT_HIGHEST_INTERRUPT_PRIORITY << 24U)
+#endif
 
 /******************************************************************************************
 *                                        TYPEDEFS                                        *
@@ -47,12 +78,30 @@
 extern os_task_t *volatile os_task_current;
 extern os_task_t *volatile os_task_next;
 
+/*! BASEPRI value used by PendSV_Handler to mask the kernel interrupts */
+__attribute__((used)) const uint32_t os_port_max_syscall_priority = BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY;
+
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+extern os_task_t *os_tasks[OS_TASK_MAX];
+
+/*! MPU_RBAR bits selecting the guard region, ORed with the stack base in PendSV_Handler */
+__attribute__((used)) const uint32_t os_port_stack_guard_rbar = PORT_MPU_RBAR_VALID_MSK | BEERTOS_MPU_STACK_GUARD_REGION;
+#endif
+
 /******************************************************************************************
 *                                        FUNCTIONS                                       *
 ******************************************************************************************/
 void os_context_switched_cb(void)
 {
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    os_task_runtime_update();
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    os_task_latency_update();
+#endif
+#ifdef BEERTOS_TRACE_TASK_SWITCHED
     BEERTOS_TRACE_TASK_SWITCHED(os_task_next);
+#endif
 }
 
 __attribute__ ((naked, optimize("-fno-stack-protector")))
@@ -60,8 +109,16 @@ void PendSV_Handler(void)
 {
     __asm volatile
     (
+    #if (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0U)
+        /* Mask the kernel interrupts, higher priority interrupts stay enabled */
+        "LDR            R0, =os_port_max_syscall_priority \n"
+        "LDR            R0, [R0]                \n"
+        "MSR            BASEPRI, R0             \n"
+        "ISB                                    \n"
+    #else
         /* Disable interrupts */
         "CPSID          i                       \n"
+    #endif
 
         /* Check if os_task_current is NULL */
         "LDR            R3, =os_task_current    \n"
@@ -89,37 +146,62 @@ void PendSV_Handler(void)
         "LDR            R2, =os_task_current    \n"
         "STR            R3, [R2]                \n"
 
+    #if (BEERTOS_USE_MPU_STACK_GUARD == true)
+        /* Move the stack guard below the stack of the next task */
+        "LDR            R2, [R3, #4]            \n"
+        "LDR            R1, =os_port_stack_guard_rbar \n"
+        "LDR            R1, [R1]                \n"
+        "ORR            R2, R2, R1              \n"
+        "LDR            R1, =0xE000ED9C         \n"
+        "STR            R2, [R1]                \n"
+        "DSB                                    \n"
+        "ISB                                    \n"
+    #endif
+
         /* Restore registers */
         "POP            {r4-r11}                \n"
 
-    #ifdef BEERTOS_TRACE_TASK_SWITCHED
+    #if defined(BEERTOS_TRACE_TASK_SWITCHED) || (BEERTOS_USE_RUNTIME_STATS == true) || \
+        (BEERTOS_USE_LATENCY_STATS == true)
         "stmdb          sp!, {r4-r11, lr}       \n"
         "bl             os_context_switched_cb  \n"
         "ldmia          sp!, {r4-r11, lr}       \n"
     #endif /* BEERTOS_TRACE_TASK_SWITCHED */
 
+    #if (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0U)
+        /* Unmask the kernel interrupts */
+        "MOV            R0, #0                  \n"
+        "MSR            BASEPRI, R0             \n"
+    #else
         /* Enable interrupts */
         "CPSIE          i                       \n"
+    #endif
 
         /* Return */
         " BX            r14                      \n"
         );
 }
 
-void os_port_disable_interrupts(void)
+/**
+ * @brief Requests the context switch at the end of an interrupt handler that used the FromISR
+ * API. The scheduler is run once for all calls made in the interrupt, the switch is taken
+ * when the handler returns.
+ *
+ * @param task_woken - value set by the FromISR functions, nothing is done if false
+ */
+void os_port_yield_from_isr(const bool task_woken)
 {
-    __asm volatile
-    (
-        "cpsid i" : : : "memory"
-    );
-}
+    if (task_woken)
+    {
+        const os_crit_state_t state = os_port_enter_critical();
 
-void os_port_enable_interrupts(void)
-{
-    __asm volatile
-    (
-        "cpsie i" : : : "memory"
-    );
+        if (os_sched_pending)
+        {
+            os_sched_process();
+        }
+
+        os_port_leave_critical(state);
+    }
 }
 
 os_stack_t* os_port_task_stack_init(void (*task)(void *), void *arg, void *stack_ptr, uint32_t stack_size)
@@ -138,7 +220,7 @@ os_stack_t* os_port_task_stack_init(void (*task)(void *), void *arg, void *stack
 
     stk -= 8U;                            /*!< R11-R4 */
 
-    #if (BEERTOS_USE_TASK_STACK_MONITOR == true)
+    #if (OS_TASK_STACK_FILL == true)
         uint32_t* user_stack = stk;
         /* Fill the unused stack space with a known value */
         while (user_stack > (uint32_t *)stack_ptr)
@@ -156,6 +238,27 @@ void os_cpu_init(void)
     PORT_NVIC_SYSPRI2 |= PORT_NVIC_PENDSV_PRI;
     /* SysTick_IRQn highest possible priority */
     PORT_NVIC_SYSPRI2 |= PORT_NVIC_SYSTICK_PRI;
+
+    /* Start the cycle counter used as the timestamp (runtime statistics, benchmarks) */
+    PORT_DCB_DEMCR |= PORT_DCB_DEMCR_TRCENA_MSK;
+    PORT_DWT_CYCCNT = 0U;
+    PORT_DWT_CTRL |= PORT_DWT_CTRL_CYCCNTENA_MSK;
+
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+    /* The guard starts on the idle task stack and is moved by PendSV_Handler. Other memory
+       keeps the default map (PRIVDEFENA), the tasks run privileged */
+    PORT_MPU_RNR = BEERTOS_MPU_STACK_GUARD_REGION;
+    PORT_MPU_RBAR = os_tasks[OS_TASK_IDLE]->stack_guard | os_port_stack_guard_rbar;
+    PORT_MPU_RASR = PORT_MPU_RASR_STACK_GUARD;
+    PORT_SCB_SHCSR |= PORT_SCB_SHCSR_MEMFAULTENA_MSK;
+    PORT_MPU_CTRL = PORT_MPU_CTRL_ENABLE_MSK | PORT_MPU_CTRL_PRIVDEFENA_MSK;
+    __asm volatile
+    (
+        "dsb                                    \n"
+        "isb                                    \n"
+        : : : "memory"
+    );
+#endif
 }
 
 void os_port_context_switch(void)
@@ -168,12 +271,111 @@ void os_port_context_switch(void)
 void SysTick_Handler(void)
 {
     BEERTOS_TRACE_ENTER_ISR();
+    os_isr_enter();
 
     extern void os_tick(void);
-    extern void os_sched(void);
 
+    /* The scheduler is run by os_tick() only if needed */
     os_tick();
-    os_sched();
 
+    os_isr_exit();
     BEERTOS_TRACE_EXIT_ISR();
-}
\ No newline at end of file
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/**
+ * @brief Suppresses the tick interrupt and puts the core to sleep for up to expected_ticks.
+ * Must be called with interrupts disabled - the core is woken up by any pending interrupt,
+ * which is then handled when the interrupts are enabled again. The SysTick reload value
+ * configured by the application is used as the number of cycles per tick.
+ *
+ * @param expected_ticks - number of ticks until the next kernel event
+ * @return number of complete ticks that elapsed and were not processed by SysTick_Handler
+ */
+uint32_t os_port_suppress_ticks_and_sleep(const uint32_t expected_ticks)
+{
+    static uint32_t cycles_per_tick = 0U;
+
+    if (0U == cycles_per_tick)
+    {
+        /* The first call - SysTick still runs with the reload value set by the application */
+        cycles_per_tick = PORT_NVIC_SYSTICK_LOAD + 1U;
+    }
+
+    const uint32_t max_ticks = PORT_NVIC_SYSTICK_MAX_RELOAD / cycles_per_tick;
+    const uint32_t ticks = (expected_ticks > max_ticks) ? max_ticks : expected_ticks;
+
+    /* Stop SysTick, the time spent here until it is restarted is lost */
+    PORT_NVIC_SYSTICK_CTRL &= ~PORT_NVIC_SYSTICK_ENABLE_MSK;
+
+    if (PORT_NVIC_INT_CTRL & PORT_NVIC_PENDSTSET_MSK)
+    {
+        /* A tick is already pending, abort and let it be processed normally */
+        PORT_NVIC_SYSTICK_CTRL |= PORT_NVIC_SYSTICK_ENABLE_MSK;
+        return 0U;
+    }
+
+    /* Fire at the end of the last suppressed tick (the current one is partially elapsed) */
+    const uint32_t reload = PORT_NVIC_SYSTICK_VAL + (cycles_per_tick * (ticks - 1U));
+
+    PORT_NVIC_SYSTICK_LOAD = reload;
+    PORT_NVIC_SYSTICK_VAL = 0U;
+    PORT_NVIC_SYSTICK_CTRL |= PORT_NVIC_SYSTICK_ENABLE_MSK;
+
+#if (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY > 0U)
+    /* Interrupts masked by BASEPRI do not wake up the core, mask them with PRIMASK
+       for the sleep instead - they are handled when the critical section is left */
+    __asm volatile
+    (
+        "cpsid          i                       \n"
+        "msr            basepri, %0             \n"
+        "dsb                                    \n"
+        "wfi                                    \n"
+        "isb                                    \n"
+        "msr            basepri, %1             \n"
+        "cpsie          i                       \n"
+        : : "r" (0U), "r" (BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY) : "memory"
+    );
+#else
+    __asm volatile
+    (
+        "dsb                                    \n"
+        "wfi                                    \n"
+        "isb                                    \n"
+        : : : "memory"
+    );
+#endif
+
+    /* Read COUNTFLAG only once - reading the control register clears it */
+    const uint32_t ctrl = PORT_NVIC_SYSTICK_CTRL;
+    PORT_NVIC_SYSTICK_CTRL = ctrl & ~PORT_NVIC_SYSTICK_ENABLE_MSK;
+
+    uint32_t elapsed_ticks;
+
+    if (ctrl & PORT_NVIC_SYSTICK_COUNTFLAG_MSK)
+    {
+        /* Woken up by SysTick, the pending SysTick_Handler processes the last tick */
+        const uint32_t cycles_since_tick = reload - PORT_NVIC_SYSTICK_VAL;
+
+        elapsed_ticks = ticks - 1U;
+        PORT_NVIC_SYSTICK_LOAD = (cycles_since_tick < cycles_per_tick) ?
+                                 (cycles_per_tick - 1U - cycles_since_tick) : (cycles_per_tick - 1U);
+    }
+    else
+    {
+        /* Woken up by another interrupt, count the complete ticks and
+           program the remaining part of the current tick */
+        const uint32_t elapsed_cycles = (ticks * cycles_per_tick) - PORT_NVIC_SYSTICK_VAL;
+
+        elapsed_ticks = elapsed_cycles / cycles_per_tick;
+        PORT_NVIC_SYSTICK_LOAD = ((elapsed_ticks + 1U) * cycles_per_tick) - elapsed_cycles;
+    }
+
+    /* Restart SysTick with the partial tick, and restore the tick period for the next reload */
+    PORT_NVIC_SYSTICK_VAL = 0U;
+    PORT_NVIC_SYSTICK_CTRL |= PORT_NVIC_SYSTICK_ENABLE_MSK;
+    PORT_NVIC_SYSTICK_LOAD = cycles_per_tick - 1U;
+
+    return elapsed_ticks;
+}
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
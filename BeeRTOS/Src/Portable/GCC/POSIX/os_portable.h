@@ -0,0 +1,56 @@
+/******************************************************************************************
+ * @brief Header File for BeeRTOS Portable Layer (POSIX host)
+ * @file os_portable.h
+ * This header file defines the portable layer's interface for running BeeRTOS as a regular
+ * process on a POSIX host (Linux). It provides the same utilities as the target ports -
+ * macros for computing the highest priority task from a set of tasks, based on their ready
+ * states, and the stack type used by the tasks - so the kernel sources are built unchanged.
+ ******************************************************************************************/
+
+#ifndef __OS_PORTABLE_H__
+#define __OS_PORTABLE_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+#if (BEERTOS_USE_MPU_STACK_GUARD == true)
+#error "BEERTOS_USE_MPU_STACK_GUARD is not supported by the POSIX port"
+#endif
+
+#define OS_LOG2(x) (32 - __builtin_clz(x))
+
+#define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK8(mask)  (32 - __builtin_clz(mask))
+#define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK16(mask) (32 - __builtin_clz(mask))
+#define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK32(mask) (32 - __builtin_clz(mask))
+#define OS_GET_HIGHEST_PRIO_TASK_FROM_MASK64(mask) (64 - __builtin_clzll(mask))
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+typedef uint32_t os_stack_t;
+
+/*! Interrupt mask state saved when a critical section is entered,
+ *  0 if the simulated interrupts were not masked */
+typedef uint32_t os_crit_state_t;
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+/* Signals have no priorities, BEERTOS_MAX_SYSCALL_INTERRUPT_PRIORITY is not used on the host */
+os_crit_state_t os_port_enter_critical(void);
+void os_port_leave_critical(const os_crit_state_t state);
+void os_port_yield_from_isr(const bool task_woken);
+/* Free-running timestamp (runtime statistics, benchmarks) - monotonic time in nanoseconds */
+uint32_t os_port_get_timestamp(void);
+
+#endif /* __OS_PORTABLE_H__ */
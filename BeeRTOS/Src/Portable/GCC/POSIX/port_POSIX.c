@@ -0,0 +1,381 @@
+/******************************************************************************************
+ * @brief OS Portable Layer Source File (POSIX host)
+ * @file port_POSIX.c
+ * This file implements the platform-specific functionalities required by BeeRTOS on a POSIX
+ * host, so the whole kernel can be run, tested and profiled as a normal Linux process.
+ * The Cortex-M exceptions are emulated with signals: SIGALRM driven by an interval timer
+ * plays the role of SysTick and SIGUSR1 plays the role of PendSV. A critical section blocks
+ * both signals, so a context switch requested inside a critical section is taken as soon
+ * as the outermost critical section is left - exactly as a pended PendSV.
+ * Task contexts are kept in ucontext_t structures, each task runs on its own host stack.
+ ******************************************************************************************/
+
+/******************************************************************************************
+*                                        INCLUDES                                        *
+******************************************************************************************/
+
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include <ucontext.h>
+#include "BeeRTOS.h"
+#include "BeeRTOS_trace_cfg.h"
+#include "os_portable.h"
+
+/******************************************************************************************
+*                                         DEFINES                                        *
+******************************************************************************************/
+
+/* Period of the simulated SysTick in microseconds */
+#ifndef BEERTOS_PORT_TICK_PERIOD_US
+#define BEERTOS_PORT_TICK_PERIOD_US         (1000U)
+#endif
+
+/* Host stack size of a single task in bytes. The stacks configured in BEERTOS_PRIORITY_LIST
+ * are sized for the target and are too small for the host signal frames and libc calls,
+ * so every task runs on a separate host stack of this size. */
+#ifndef BEERTOS_PORT_HOST_STACK_SIZE
+#define BEERTOS_PORT_HOST_STACK_SIZE        (64U * 1024U)
+#endif
+
+/* One host context per configured stack - priority slots, task pool slots and the parts of
+ * the shared stack used by basic tasks */
+#if (BEERTOS_USE_TASK_POOL == true)
+#define PORT_CONTEXT_POOL                   (OS_TASK_POOL_SLOT_COUNT)
+#else
+#define PORT_CONTEXT_POOL                   (0U)
+#endif
+#define PORT_CONTEXT_MAX                    (OS_TASK_MAX + PORT_CONTEXT_POOL + OS_BASIC_TASK_COUNT)
+
+/* Signals used to emulate the Cortex-M exceptions */
+#define PORT_SYSTICK_SIGNAL                 SIGALRM
+#define PORT_PENDSV_SIGNAL                  SIGUSR1
+
+/******************************************************************************************
+*                                        TYPEDEFS                                        *
+******************************************************************************************/
+
+/*! Host context of a single task, os_task_t.sp points to this structure */
+typedef struct
+{
+    ucontext_t context;
+    void (*task)(void *);
+    void *arg;
+    uint8_t *stack_top; /* end of the configured stack, identifies the context, NULL if free */
+} port_task_context_t;
+
+/******************************************************************************************
+*                                        VARIABLES                                       *
+******************************************************************************************/
+
+extern os_task_t *volatile os_task_current;
+extern os_task_t *volatile os_task_next;
+
+/*! Host contexts and stacks of all tasks (one per configured stack) */
+static port_task_context_t port_contexts[PORT_CONTEXT_MAX];
+static uint8_t port_stacks[PORT_CONTEXT_MAX][BEERTOS_PORT_HOST_STACK_SIZE] __attribute__((aligned(16)));
+static uint32_t port_contexts_used;
+
+/*! Set of signals masked while "interrupts are disabled" */
+static sigset_t port_interrupts_mask;
+static bool port_interrupts_mask_ready;
+
+/******************************************************************************************
+*                                        FUNCTIONS                                       *
+******************************************************************************************/
+void os_context_switched_cb(void)
+{
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    os_task_runtime_update();
+#endif
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    os_task_latency_update();
+#endif
+#ifdef BEERTOS_TRACE_TASK_SWITCHED
+    BEERTOS_TRACE_TASK_SWITCHED(os_task_next);
+#endif
+}
+
+static void port_task_entry(int idx)
+{
+    port_task_context_t *const ctx = &port_contexts[idx];
+
+    ctx->task(ctx->arg);
+
+    /* Tasks must never return - same as the exception return to 0xE on the target */
+    abort();
+}
+
+static void port_interrupts_mask_init(void)
+{
+    sigemptyset(&port_interrupts_mask);
+    sigaddset(&port_interrupts_mask, PORT_SYSTICK_SIGNAL);
+    sigaddset(&port_interrupts_mask, PORT_PENDSV_SIGNAL);
+    port_interrupts_mask_ready = true;
+}
+
+static void PendSV_Handler(int sig)
+{
+    (void)sig;
+
+    os_task_t *const prev = os_task_current;
+    os_task_t *const next = os_task_next;
+
+    if (prev == next)
+    {
+        return;
+    }
+
+    os_task_current = next;
+
+#if defined(BEERTOS_TRACE_TASK_SWITCHED) || (BEERTOS_USE_RUNTIME_STATS == true) || \
+    (BEERTOS_USE_LATENCY_STATS == true)
+    os_context_switched_cb();
+#endif /* BEERTOS_TRACE_TASK_SWITCHED */
+
+    if (NULL == prev)
+    {
+        /* First switch, the context of the caller is never resumed */
+        setcontext(&((port_task_context_t *)next->sp)->context);
+    }
+    else
+    {
+        swapcontext(&((port_task_context_t *)prev->sp)->context,
+                    &((port_task_context_t *)next->sp)->context);
+    }
+}
+
+static void SysTick_Handler(int sig)
+{
+    (void)sig;
+
+    extern void os_tick(void);
+
+    BEERTOS_TRACE_ENTER_ISR();
+    os_isr_enter();
+
+    os_tick();
+
+    /* Both signals are masked by the handler's sa_mask, so the critical sections in the
+       handler are nested and do not run the scheduler - run it here, at the ISR exit */
+    if (os_sched_pending)
+    {
+        os_sched_process();
+    }
+
+    os_isr_exit();
+    BEERTOS_TRACE_EXIT_ISR();
+}
+
+os_crit_state_t os_port_enter_critical(void)
+{
+    sigset_t previous;
+
+    /* os_init enters a critical section before os_cpu_init is called */
+    if (!port_interrupts_mask_ready)
+    {
+        port_interrupts_mask_init();
+    }
+
+    sigprocmask(SIG_BLOCK, &port_interrupts_mask, &previous);
+
+    return sigismember(&previous, PORT_SYSTICK_SIGNAL) ? 1U : 0U;
+}
+
+void os_port_leave_critical(const os_crit_state_t state)
+{
+    if (0U == state)
+    {
+        sigprocmask(SIG_UNBLOCK, &port_interrupts_mask, NULL);
+    }
+}
+
+/**
+ * @brief Requests the context switch at the end of an interrupt handler that used the FromISR
+ * API. The scheduler is run once for all calls made in the interrupt, the switch is taken
+ * when the handler returns.
+ *
+ * @param task_woken - value set by the FromISR functions, nothing is done if false
+ */
+void os_port_yield_from_isr(const bool task_woken)
+{
+    if (task_woken)
+    {
+        const os_crit_state_t state = os_port_enter_critical();
+
+        if (os_sched_pending)
+        {
+            os_sched_process();
+        }
+
+        os_port_leave_critical(state);
+    }
+}
+
+uint32_t os_port_get_timestamp(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec);
+}
+
+os_stack_t* os_port_task_stack_init(void (*task)(void *), void *arg, void *stack_ptr, uint32_t stack_size)
+{
+    uint8_t *const stack_top = (uint8_t *)stack_ptr + stack_size;
+    uint32_t idx = PORT_CONTEXT_MAX;
+    uint32_t free_idx = port_contexts_used;
+
+    /* The stack of a live task never overlaps the new stack, so a context ending within it
+       belongs to a finished task (a reused pool slot or a completed basic task) */
+    for (uint32_t i = 0U; i < port_contexts_used; i++)
+    {
+        uint8_t *const end = port_contexts[i].stack_top;
+
+        if ((end > (uint8_t *)stack_ptr) && (end <= stack_top))
+        {
+            if (PORT_CONTEXT_MAX == idx)
+            {
+                idx = i;
+            }
+            else
+            {
+                port_contexts[i].stack_top = NULL;
+            }
+        }
+
+        if ((NULL == port_contexts[i].stack_top) && (free_idx == port_contexts_used))
+        {
+            free_idx = i;
+        }
+    }
+
+    if (PORT_CONTEXT_MAX == idx)
+    {
+        idx = free_idx;
+        if (idx == port_contexts_used)
+        {
+            if (port_contexts_used >= PORT_CONTEXT_MAX)
+            {
+                abort();
+            }
+            port_contexts_used++;
+        }
+    }
+
+    port_task_context_t *const ctx = &port_contexts[idx];
+
+    ctx->task = task;
+    ctx->arg = arg;
+    ctx->stack_top = stack_top;
+
+    getcontext(&ctx->context);
+    ctx->context.uc_stack.ss_sp = port_stacks[idx];
+    ctx->context.uc_stack.ss_size = sizeof(port_stacks[idx]);
+    ctx->context.uc_link = NULL;
+    /* Tasks start with interrupts enabled */
+    sigemptyset(&ctx->context.uc_sigmask);
+    makecontext(&ctx->context, (void (*)(void))port_task_entry, 1, (int)idx);
+
+    #if (OS_TASK_STACK_FILL == true)
+        /* The configured stack is not used on the host, keep it filled with the pattern */
+        os_stack_t *user_stack = (os_stack_t *)stack_ptr;
+        for (uint32_t i = 0U; i < stack_size / sizeof(os_stack_t); i++)
+        {
+            user_stack[i] = OS_TASK_STACK_PATTERN;
+        }
+    #else
+        (void)stack_ptr;
+        (void)stack_size;
+    #endif
+
+    return (os_stack_t *)ctx;
+}
+
+void os_cpu_init(void)
+{
+    struct sigaction action = {0};
+
+    port_interrupts_mask_init();
+
+    /* Handlers run with both signals masked - PendSV is tail-chained after SysTick */
+    action.sa_mask = port_interrupts_mask;
+
+    action.sa_handler = PendSV_Handler;
+    sigaction(PORT_PENDSV_SIGNAL, &action, NULL);
+
+    action.sa_handler = SysTick_Handler;
+    sigaction(PORT_SYSTICK_SIGNAL, &action, NULL);
+
+    /* Start the simulated SysTick */
+    const struct itimerval tick =
+    {
+        .it_interval = {0, BEERTOS_PORT_TICK_PERIOD_US},
+        .it_value = {0, BEERTOS_PORT_TICK_PERIOD_US},
+    };
+    setitimer(ITIMER_REAL, &tick, NULL);
+}
+
+void os_port_context_switch(void)
+{
+    BEERTOS_TRACE_EXIT_ISR_SCHEDULER();
+    /* Pend the context switch, it is taken when the signals are unmasked */
+    raise(PORT_PENDSV_SIGNAL);
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/**
+ * @brief Suppresses the simulated SysTick and sleeps for expected_ticks.
+ * Must be called with interrupts disabled. The host has no other interrupt sources,
+ * so the sleep always lasts the whole expected time and all ticks are reported as elapsed.
+ *
+ * @param expected_ticks - number of ticks until the next kernel event
+ * @return number of ticks that elapsed and were not processed by SysTick_Handler
+ */
+uint32_t os_port_suppress_ticks_and_sleep(const uint32_t expected_ticks)
+{
+    const uint32_t max_ticks = UINT32_MAX / BEERTOS_PORT_TICK_PERIOD_US;
+    const uint32_t ticks = (expected_ticks > max_ticks) ? max_ticks : expected_ticks;
+    const struct itimerval stop = {0};
+    struct itimerval remaining;
+    sigset_t pending;
+
+    /* Stop the tick timer, keep the time left until the next tick */
+    setitimer(ITIMER_REAL, &stop, &remaining);
+
+    sigpending(&pending);
+    if (sigismember(&pending, PORT_SYSTICK_SIGNAL) ||
+        ((0 == remaining.it_value.tv_sec) && (0 == remaining.it_value.tv_usec)))
+    {
+        /* A tick is already pending, abort and let it be processed normally */
+        remaining.it_interval.tv_sec = 0;
+        remaining.it_interval.tv_usec = BEERTOS_PORT_TICK_PERIOD_US;
+        remaining.it_value = remaining.it_interval;
+        setitimer(ITIMER_REAL, &remaining, NULL);
+        return 0U;
+    }
+
+    /* Fire at the end of the last suppressed tick, then continue with the normal tick period */
+    const uint64_t sleep_us = ((uint64_t)remaining.it_value.tv_sec * 1000000U) +
+                              (uint64_t)remaining.it_value.tv_usec +
+                              ((uint64_t)(ticks - 1U) * BEERTOS_PORT_TICK_PERIOD_US);
+    const struct itimerval wakeup =
+    {
+        .it_interval = {0, BEERTOS_PORT_TICK_PERIOD_US},
+        .it_value = {(time_t)(sleep_us / 1000000U), (suseconds_t)(sleep_us % 1000000U)},
+    };
+    sigset_t systick_set;
+    int sig;
+
+    sigemptyset(&systick_set);
+    sigaddset(&systick_set, PORT_SYSTICK_SIGNAL);
+
+    setitimer(ITIMER_REAL, &wakeup, NULL);
+    /* The tick signal is consumed here, so the last tick is credited as well */
+    sigwait(&systick_set, &sig);
+
+    return ticks;
+}
+#endif /* BEERTOS_USE_TICKLESS_IDLE */
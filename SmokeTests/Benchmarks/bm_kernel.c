@@ -0,0 +1,216 @@
+#include "bm_utils.h"
+
+/* Timeout of the partner task waits, it is always woken up before */
+#define BM_PARTNER_TIMEOUT (1000U)
+
+typedef enum
+{
+    BM_PARTNER_STOP = 0,
+    BM_PARTNER_SEMAPHORE,
+    BM_PARTNER_MESSAGE,
+    BM_PARTNER_DELAY,
+} bm_partner_mode_t;
+
+typedef enum
+{
+    BM_SEMAPHORE_SIGNAL = 0,
+    BM_SEMAPHORE_WAIT,
+    BM_SEMAPHORE_WAIT_EMPTY,
+    BM_MESSAGE_SEND,
+    BM_MESSAGE_RECEIVE,
+    BM_QUEUE_PUSH,
+    BM_QUEUE_POP,
+    BM_MUTEX_LOCK,
+    BM_MUTEX_UNLOCK,
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    BM_TASK_NOTIFY,
+    BM_TASK_NOTIFY_WAIT,
+#endif
+    BM_SEMAPHORE_SIGNAL_WAKE,
+    BM_SEMAPHORE_SWITCH,
+    BM_MESSAGE_SEND_WAKE,
+    BM_MESSAGE_SWITCH,
+    BM_DELAY_SWITCH,
+    BM_COUNT
+} bm_id_t;
+
+static bm_stat_t bm_stats[BM_COUNT];
+
+static volatile bm_partner_mode_t bm_partner_mode;
+static volatile uint32_t bm_partner_start;
+static volatile uint32_t bm_partner_end;
+static volatile bool bm_partner_blocked;
+
+/* Highest priority task - blocks on the primitive selected by bm_partner_mode, so the main
+ * task measures the blocking paths and the context switch to the woken task */
+void bm_task_partner(void *arg)
+{
+    uint32_t data;
+
+    while (1)
+    {
+        switch (bm_partner_mode)
+        {
+            case BM_PARTNER_SEMAPHORE:
+                (void)os_semaphore_wait(SEMAPHORE_BM, BM_PARTNER_TIMEOUT);
+                bm_partner_end = bm_timestamp();
+                break;
+            case BM_PARTNER_MESSAGE:
+                (void)os_message_receive(MESSAGE_BM, &data, BM_PARTNER_TIMEOUT);
+                bm_partner_end = bm_timestamp();
+                break;
+            case BM_PARTNER_DELAY:
+                bm_partner_blocked = true;
+                bm_partner_start = bm_timestamp();
+                os_delay(1U);
+                break;
+            default:
+                os_task_stop(OS_TASK_BM);
+                break;
+        }
+    }
+}
+
+static void bm_partner_stop(void)
+{
+    /* The delayed partner stops on its next wakeup */
+    bm_partner_mode = BM_PARTNER_STOP;
+    os_delay(2U);
+}
+
+static void bm_non_blocking(void)
+{
+    uint32_t start;
+    uint32_t data = 0U;
+
+    for (uint32_t i = 0U; i < BM_ITERATIONS; i++)
+    {
+        start = bm_timestamp();
+        (void)os_semaphore_signal(SEMAPHORE_BM);
+        bm_stat_add(&bm_stats[BM_SEMAPHORE_SIGNAL], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_semaphore_wait(SEMAPHORE_BM, 0U);
+        bm_stat_add(&bm_stats[BM_SEMAPHORE_WAIT], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_semaphore_wait(SEMAPHORE_BM, 0U);
+        bm_stat_add(&bm_stats[BM_SEMAPHORE_WAIT_EMPTY], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_message_send(MESSAGE_BM, &data, 0U);
+        bm_stat_add(&bm_stats[BM_MESSAGE_SEND], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_message_receive(MESSAGE_BM, &data, 0U);
+        bm_stat_add(&bm_stats[BM_MESSAGE_RECEIVE], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_queue_push(QUEUE_2, &data, sizeof(data));
+        bm_stat_add(&bm_stats[BM_QUEUE_PUSH], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_queue_pop(QUEUE_2, &data, sizeof(data));
+        bm_stat_add(&bm_stats[BM_QUEUE_POP], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_mutex_lock(MUTEX_BM, 0U);
+        bm_stat_add(&bm_stats[BM_MUTEX_LOCK], start, bm_timestamp());
+
+        start = bm_timestamp();
+        os_mutex_unlock(MUTEX_BM);
+        bm_stat_add(&bm_stats[BM_MUTEX_UNLOCK], start, bm_timestamp());
+
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+        start = bm_timestamp();
+        (void)os_task_notify(OS_TASK_UT_MAIN, i, OS_TASK_NOTIFY_OVERWRITE);
+        bm_stat_add(&bm_stats[BM_TASK_NOTIFY], start, bm_timestamp());
+
+        start = bm_timestamp();
+        (void)os_task_notify_wait(0xFFFFFFFFU, &data, 0U);
+        bm_stat_add(&bm_stats[BM_TASK_NOTIFY_WAIT], start, bm_timestamp());
+#endif
+    }
+}
+
+static void bm_blocking(void)
+{
+    uint32_t start;
+    uint32_t end;
+    uint32_t data = 0U;
+
+    /* The partner preempts this task and blocks on the semaphore */
+    bm_partner_mode = BM_PARTNER_SEMAPHORE;
+    (void)os_task_start(OS_TASK_BM);
+    for (uint32_t i = 0U; i < BM_ITERATIONS; i++)
+    {
+        start = bm_timestamp();
+        (void)os_semaphore_signal(SEMAPHORE_BM);
+        end = bm_timestamp();
+        bm_stat_add(&bm_stats[BM_SEMAPHORE_SIGNAL_WAKE], start, end);
+        bm_stat_add(&bm_stats[BM_SEMAPHORE_SWITCH], start, bm_partner_end);
+    }
+
+    bm_partner_mode = BM_PARTNER_MESSAGE;
+    (void)os_semaphore_signal(SEMAPHORE_BM);
+    for (uint32_t i = 0U; i < BM_ITERATIONS; i++)
+    {
+        start = bm_timestamp();
+        (void)os_message_send(MESSAGE_BM, &data, 0U);
+        end = bm_timestamp();
+        bm_stat_add(&bm_stats[BM_MESSAGE_SEND_WAKE], start, end);
+        bm_stat_add(&bm_stats[BM_MESSAGE_SWITCH], start, bm_partner_end);
+    }
+
+    /* The partner delays itself each tick, this task runs when it is blocked */
+    bm_partner_blocked = false;
+    bm_partner_mode = BM_PARTNER_DELAY;
+    (void)os_message_send(MESSAGE_BM, &data, 0U);
+    for (uint32_t i = 0U; i < BM_ITERATIONS; i++)
+    {
+        while (!bm_partner_blocked)
+        {
+        }
+        end = bm_timestamp();
+        bm_partner_blocked = false;
+        bm_stat_add(&bm_stats[BM_DELAY_SWITCH], bm_partner_start, end);
+    }
+
+    bm_partner_stop();
+}
+
+void TEST_benchmarks(void)
+{
+    PRINT_UT_BEGIN();
+
+    bm_stat_init(&bm_stats[BM_SEMAPHORE_SIGNAL], "semaphore_signal");
+    bm_stat_init(&bm_stats[BM_SEMAPHORE_WAIT], "semaphore_wait");
+    bm_stat_init(&bm_stats[BM_SEMAPHORE_WAIT_EMPTY], "semaphore_wait_empty");
+    bm_stat_init(&bm_stats[BM_MESSAGE_SEND], "message_send");
+    bm_stat_init(&bm_stats[BM_MESSAGE_RECEIVE], "message_receive");
+    bm_stat_init(&bm_stats[BM_QUEUE_PUSH], "queue_push");
+    bm_stat_init(&bm_stats[BM_QUEUE_POP], "queue_pop");
+    bm_stat_init(&bm_stats[BM_MUTEX_LOCK], "mutex_lock");
+    bm_stat_init(&bm_stats[BM_MUTEX_UNLOCK], "mutex_unlock");
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    bm_stat_init(&bm_stats[BM_TASK_NOTIFY], "task_notify");
+    bm_stat_init(&bm_stats[BM_TASK_NOTIFY_WAIT], "task_notify_wait");
+#endif
+    bm_stat_init(&bm_stats[BM_SEMAPHORE_SIGNAL_WAKE], "semaphore_signal_wake");
+    bm_stat_init(&bm_stats[BM_SEMAPHORE_SWITCH], "semaphore_switch");
+    bm_stat_init(&bm_stats[BM_MESSAGE_SEND_WAKE], "message_send_wake");
+    bm_stat_init(&bm_stats[BM_MESSAGE_SWITCH], "message_switch");
+    bm_stat_init(&bm_stats[BM_DELAY_SWITCH], "delay_switch");
+
+    bm_calibrate();
+    bm_non_blocking();
+    bm_blocking();
+
+    for (uint32_t i = 0U; i < BM_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL(BM_ITERATIONS, bm_stats[i].count);
+        TEST_ASSERT_TRUE(bm_stats[i].min <= bm_stats[i].max);
+    }
+
+    bm_report(bm_stats, BM_COUNT);
+}
@@ -0,0 +1,133 @@
+#include "bm_utils.h"
+
+/* Length of the run of one task set in ticks - two hyperperiods of the task set */
+#define BM_SCHED_DURATION (700U)
+/* Time for the jobs released before the end of the run to complete */
+#define BM_SCHED_DRAIN (100U)
+
+/* Periodic task of the benchmark, the deadline is equal to the period */
+typedef struct
+{
+    os_task_id_t id;
+    uint32_t period; /* in ticks */
+    uint32_t wcet;   /* execution time of one job in ticks */
+    uint32_t jobs;
+    uint32_t misses;
+} bm_sched_task_t;
+
+/* The same task set is run with both policies, the utilization is 20/50 + 35/70 = 0.9 -
+ * above the rate monotonic bound (0.83 for two tasks), the second task misses its deadline
+ * with fixed priorities (its response time is 75 ticks), EDF schedules any set up to 1.0 */
+static bm_sched_task_t bm_sched_tasks[] =
+{
+    {OS_TASK_BM_RM_1, 50U, 20U, 0U, 0U},
+    {OS_TASK_BM_RM_2, 70U, 35U, 0U, 0U},
+    {OS_TASK_BM_EDF_1, 50U, 20U, 0U, 0U},
+    {OS_TASK_BM_EDF_2, 70U, 35U, 0U, 0U},
+};
+
+static volatile bool bm_sched_running;
+static volatile uint32_t bm_sched_start;
+/* Task which executed last, a change is counted as a context switch between the tasks */
+static const bm_sched_task_t *volatile bm_sched_owner;
+static volatile uint32_t bm_sched_switches;
+
+/* Periodic task released at bm_sched_start, each job executes wcet ticks of CPU time */
+void bm_sched_task(void *arg)
+{
+    bm_sched_task_t *const task = &bm_sched_tasks[(uintptr_t)arg];
+
+    while (1)
+    {
+        uint32_t release = bm_sched_start;
+
+        while (bm_sched_running)
+        {
+            uint32_t tick = os_get_tick_count();
+            uint32_t executed = 0U;
+
+            /* Only the ticks observed while running are counted, not the preempted time */
+            while (executed < task->wcet)
+            {
+                const uint32_t now = os_get_tick_count();
+
+                if (bm_sched_owner != task)
+                {
+                    bm_sched_owner = task;
+                    bm_sched_switches++;
+                }
+                if (now != tick)
+                {
+                    tick = now;
+                    executed++;
+                }
+            }
+            bm_sched_owner = NULL;
+
+            task->jobs++;
+            if ((int32_t)(os_get_tick_count() - (release + task->period)) >= 0)
+            {
+                task->misses++;
+            }
+            (void)os_delay_until(&release, task->period);
+        }
+
+        os_task_stop(task->id);
+    }
+}
+
+/* Runs two tasks of the set from the same release tick, returns the number of switches */
+static uint32_t bm_sched_run(bm_sched_task_t *const first, bm_sched_task_t *const second)
+{
+    bm_sched_switches = 0U;
+    bm_sched_owner = NULL;
+    bm_sched_start = os_get_tick_count();
+    bm_sched_running = true;
+
+    const os_crit_state_t crit_state = os_enter_critical_section();
+    (void)os_task_start(first->id);
+    (void)os_task_start(second->id);
+    os_leave_critical_section(crit_state);
+
+    os_delay(BM_SCHED_DURATION);
+    bm_sched_running = false;
+    os_delay(BM_SCHED_DRAIN);
+
+    return bm_sched_switches;
+}
+
+static void bm_sched_report(const char *const policy, const bm_sched_task_t *const tasks, const uint32_t switches)
+{
+    UnityPrint(policy);
+    UnityPrint(",");
+    UnityPrintNumberUnsigned(tasks[0].jobs + tasks[1].jobs);
+    UnityPrint(",");
+    UnityPrintNumberUnsigned(tasks[0].misses + tasks[1].misses);
+    UnityPrint(",");
+    UnityPrintNumberUnsigned(switches);
+    UnityPrint("\n");
+}
+
+void TEST_benchmarks_sched(void)
+{
+    PRINT_UT_BEGIN();
+
+    const uint32_t fixed_switches = bm_sched_run(&bm_sched_tasks[0], &bm_sched_tasks[1]);
+    const uint32_t edf_switches = bm_sched_run(&bm_sched_tasks[2], &bm_sched_tasks[3]);
+
+    for (uint32_t i = 0U; i < (sizeof(bm_sched_tasks) / sizeof(bm_sched_tasks[0])); i++)
+    {
+        TEST_ASSERT_TRUE(bm_sched_tasks[i].jobs >= (BM_SCHED_DURATION / bm_sched_tasks[i].period));
+    }
+    TEST_ASSERT_TRUE(bm_sched_tasks[1].misses > 0U);
+#if (BEERTOS_USE_EDF == true)
+    TEST_ASSERT_EQUAL(0U, bm_sched_tasks[2].misses + bm_sched_tasks[3].misses);
+#endif
+
+    /* Machine readable summary - one CSV line per policy between the markers */
+    UnityPrint("BM_SCHED_BEGIN\n");
+    UnityPrint("policy,jobs,misses,switches\n");
+    bm_sched_report("fixed_priority", &bm_sched_tasks[0], fixed_switches);
+    bm_sched_report("edf", &bm_sched_tasks[2], edf_switches);
+    UnityPrint("BM_SCHED_END\n");
+}
@@ -0,0 +1,87 @@
+#include "bm_utils.h"
+
+/* Cost of reading the timestamp twice, subtracted from every sample */
+static uint32_t bm_overhead;
+
+void bm_calibrate(void)
+{
+    bm_overhead = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < 16U; i++)
+    {
+        const uint32_t start = bm_timestamp();
+        const uint32_t end = bm_timestamp();
+
+        if ((end - start) < bm_overhead)
+        {
+            bm_overhead = end - start;
+        }
+    }
+}
+
+void bm_stat_init(bm_stat_t *const stat, const char *const name)
+{
+    stat->name = name;
+    stat->min = UINT32_MAX;
+    stat->max = 0U;
+    stat->sum = 0U;
+    stat->count = 0U;
+}
+
+void bm_stat_add(bm_stat_t *const stat, const uint32_t start, const uint32_t end)
+{
+    /* Unsigned difference handles the timestamp wrap-around */
+    uint32_t sample = end - start;
+
+    sample = (sample > bm_overhead) ? (sample - bm_overhead) : 0U;
+
+    if (sample < stat->min)
+    {
+        stat->min = sample;
+    }
+    if (sample > stat->max)
+    {
+        stat->max = sample;
+    }
+    stat->sum += sample;
+    stat->count++;
+}
+
+uint32_t bm_stat_mean(const bm_stat_t *const stat)
+{
+    return (0U != stat->count) ? (uint32_t)(stat->sum / stat->count) : 0U;
+}
+
+static void bm_print_field(const char *const separator, const uint32_t value)
+{
+    UnityPrint(separator);
+    UnityPrintNumberUnsigned(value);
+}
+
+void bm_report(const bm_stat_t *const stats, const uint32_t count)
+{
+    /* Human readable table */
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        UnityPrint("  ");
+        UnityPrint(stats[i].name);
+        bm_print_field(": min ", stats[i].min);
+        bm_print_field(" mean ", bm_stat_mean(&stats[i]));
+        bm_print_field(" max ", stats[i].max);
+        UnityPrint("\n");
+    }
+
+    /* Machine readable summary - one CSV line per benchmark between the markers */
+    UnityPrint("BM_SUMMARY_BEGIN\n");
+    UnityPrint("name,count,min,mean,max\n");
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        UnityPrint(stats[i].name);
+        bm_print_field(",", stats[i].count);
+        bm_print_field(",", stats[i].min);
+        bm_print_field(",", bm_stat_mean(&stats[i]));
+        bm_print_field(",", stats[i].max);
+        UnityPrint("\n");
+    }
+    UnityPrint("BM_SUMMARY_END\n");
+}
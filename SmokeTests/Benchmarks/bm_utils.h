@@ -0,0 +1,31 @@
+#ifndef __BM_UTILS_H__
+#define __BM_UTILS_H__
+
+#include "ut_utils.h"
+
+/* Number of measured calls of every benchmark */
+#define BM_ITERATIONS (100U)
+
+/* Statistics of one benchmark, in port timestamp units (CPU cycles on Cortex-M4,
+ * nanoseconds on the POSIX host) with the timestamp overhead subtracted */
+typedef struct
+{
+    const char *name;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} bm_stat_t;
+
+static inline uint32_t bm_timestamp(void)
+{
+    return os_port_get_timestamp();
+}
+
+void bm_calibrate(void);
+void bm_stat_init(bm_stat_t *const stat, const char *const name);
+void bm_stat_add(bm_stat_t *const stat, const uint32_t start, const uint32_t end);
+uint32_t bm_stat_mean(const bm_stat_t *const stat);
+void bm_report(const bm_stat_t *const stats, const uint32_t count);
+
+#endif // __BM_UTILS_H__
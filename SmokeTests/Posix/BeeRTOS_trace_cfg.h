@@ -0,0 +1,62 @@
+/******************************************************************************************
+ * @brief Trace Configuration Header for BeeRTOS (POSIX host build)
+ * @file BeeRTOS_trace_cfg.h
+ * Host variant of the trace configuration used when the smoke tests are run on a POSIX
+ * host. SEGGER SystemView is not available there, so the hooks are mapped to the native
+ * trace recorder (BEERTOS_USE_TRACE_RECORDER) or compiled out.
+ * Put this directory before BeeRTOS/Cfg in the include path to use it.
+ ******************************************************************************************/
+
+#ifndef __BEERTOS_TRACE_CFG_H__
+#define __BEERTOS_TRACE_CFG_H__
+
+/******************************************************************************************
+ *                                        INCLUDES                                        *
+ ******************************************************************************************/
+
+#include "BeeRTOS.h"
+#if (BEERTOS_USE_TRACE_RECORDER == true)
+/* Native trace recorder - defines all BEERTOS_TRACE_* hooks */
+#include "BeeRTOS_trace.h"
+#else
+
+/******************************************************************************************
+ *                                         DEFINES                                        *
+ ******************************************************************************************/
+
+#define BEERTOS_TRACE_INIT() {}
+#define BEERTOS_TRACE_TICK(ticks) (void)ticks;
+#define BEERTOS_TRACE_TASK_CREATE(task, name, stack_size) {}
+#define BEERTOS_TRACE_TASK_SWITCHED(task) {}
+#define BEERTOS_TRACE_TASK_READY(task) {}
+#define BEERTOS_TRACE_TASK_DELAYED(task) {}
+#define BEERTOS_TRACE_SEMAPHORE_BLOCKED(task) {}
+#define BEERTOS_TRACE_SEMAPHORE_UNBLOCKED(task) {}
+#define BEERTOS_TRACE_MESSAGE_BLOCKED(task) {}
+#define BEERTOS_TRACE_MESSAGE_UNBLOCKED(task) {}
+#define BEERTOS_TRACE_MUTEX_BLOCKED(task) {}
+#define BEERTOS_TRACE_MUTEX_UNBLOCKED(task) {}
+#define BEERTOS_TRACE_EVENT_BLOCKED(task) {}
+#define BEERTOS_TRACE_EVENT_UNBLOCKED(task) {}
+#define BEERTOS_TRACE_MUTEX_PRIORITY_INHERITANCE(task, priority) {}
+#define BEERTOS_TRACE_MUTEX_PRIORITY_RESTORE(task, priority) {}
+#define BEERTOS_TRACE_EXIT_ISR_SCHEDULER() {}
+#define BEERTOS_TRACE_ENTER_ISR() {}
+#define BEERTOS_TRACE_EXIT_ISR() {}
+#define BEERTOS_TRACE_ALARM_START(alarm_id, period, periodic) {}
+#define BEERTOS_TRACE_ALARM_CANCEL(alarm_id) {}
+#endif /* BEERTOS_USE_TRACE_RECORDER */
+
+/******************************************************************************************
+ *                                        TYPEDEFS                                        *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                    GLOBAL VARIABLES                                    *
+ ******************************************************************************************/
+
+/******************************************************************************************
+ *                                   FUNCTION PROTOTYPES                                  *
+ ******************************************************************************************/
+
+#endif /* __BEERTOS_TRACE_CFG_H__ */
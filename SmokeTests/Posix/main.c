@@ -0,0 +1,21 @@
+/******************************************************************************************
+ * @brief Host entry point for running the BeeRTOS smoke tests on a POSIX host
+ * @file main.c
+ * Initializes the OS and waits for the first simulated SysTick, which switches to the
+ * highest priority ready task. The context of main() is never resumed.
+ ******************************************************************************************/
+
+#include <unistd.h>
+#include "BeeRTOS.h"
+
+int main(void)
+{
+    os_init();
+
+    while (1)
+    {
+        pause();
+    }
+
+    return 0;
+}
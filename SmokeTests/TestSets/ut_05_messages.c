@@ -34,7 +34,7 @@ void ut_task_msg_2(void *arg)
     ret = os_message_send(MESSAGE_ONE, msg2, 0);
     TEST_ASSERT_TRUE_MESSAGE(ret, "Message should be sent successfully when queue is not full.");
 
-    uint8_t msgTimeout[] = {'T', 'I', 'M', 'E', 'O', 'U', 'T'};
+    uint8_t msgTimeout[8] = {'T', 'I', 'M', 'E', 'O', 'U', 'T', '\0'};
     ret = os_message_send(MESSAGE_ONE, msgTimeout, 1000);
     TEST_ASSERT_TRUE_MESSAGE(ret, "Message sending should be successful if timeout is not reached.");
 
@@ -0,0 +1,31 @@
+#include "ut_utils.h"
+
+void TEST_delay_until(void)
+{
+    PRINT_UT_BEGIN();
+
+    bool ret;
+    uint32_t last_wake = os_get_tick_count();
+    const uint32_t start = last_wake;
+
+    /* Periodic delays do not drift, regardless of the time spent in the loop body */
+    for (uint32_t i = 1U; i <= 5U; i++)
+    {
+        ut_blocking_delay(i);
+        ret = os_delay_until(&last_wake, 10);
+        TEST_ASSERT_TRUE_MESSAGE(ret, "Deadline should be met.");
+        TEST_ASSERT_EQUAL(start + (i * 10U), last_wake);
+        TEST_ASSERT_EQUAL(last_wake, os_get_tick_count());
+    }
+
+    /* The loop body overruns the period, the missed deadline is reported without delay */
+    ut_blocking_delay(15);
+    ret = os_delay_until(&last_wake, 10);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Missed deadline should be reported.");
+    TEST_ASSERT_EQUAL(start + 60U, last_wake);
+
+    /* The next period is aligned to the original phase again */
+    ret = os_delay_until(&last_wake, 10);
+    TEST_ASSERT_TRUE_MESSAGE(ret, "Deadline should be met.");
+    TEST_ASSERT_EQUAL(start + 70U, os_get_tick_count());
+}
@@ -0,0 +1,77 @@
+#include "ut_utils.h"
+
+#define UT_RR_TASK_COUNT    (2U)
+
+static volatile uint32_t rr_ticks[UT_RR_TASK_COUNT];
+/* The second task releases the first one from an emulated interrupt */
+static volatile bool rr_isr_release;
+static volatile bool rr_isr_task_woken;
+
+void ut_task_rr(void *arg)
+{
+    const uint32_t idx = (uint32_t)(uintptr_t)arg;
+    uint32_t last_tick = os_get_tick_count();
+
+    /* Never blocks - the tasks of the group are switched only by the time slicing */
+    while (1)
+    {
+        if ((1U == idx) && rr_isr_release)
+        {
+            bool task_woken = false;
+            const os_crit_state_t state = os_port_enter_critical();
+
+            (void)os_task_start_from_isr(OS_TASK_RR_1, &task_woken);
+            rr_isr_task_woken = task_woken;
+            rr_isr_release = false;
+            os_port_yield_from_isr(task_woken);
+
+            os_port_leave_critical(state);
+        }
+
+        const uint32_t now = os_get_tick_count();
+        if (now != last_tick)
+        {
+            rr_ticks[idx]++;
+            last_tick = now;
+        }
+    }
+}
+
+void TEST_round_robin(void)
+{
+    PRINT_UT_BEGIN();
+
+    os_task_start(OS_TASK_RR_1);
+    os_task_start(OS_TASK_RR_2);
+
+    os_delay(100);
+
+    os_task_stop(OS_TASK_RR_1);
+    os_task_stop(OS_TASK_RR_2);
+
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+    /* Both tasks of the group should have got about half of the CPU time */
+    TEST_ASSERT_GREATER_OR_EQUAL(40, rr_ticks[0]);
+    TEST_ASSERT_GREATER_OR_EQUAL(40, rr_ticks[1]);
+    TEST_ASSERT_LESS_OR_EQUAL(60, rr_ticks[0]);
+    TEST_ASSERT_LESS_OR_EQUAL(60, rr_ticks[1]);
+#else
+    /* Without the time slicing the first task has a higher priority and never blocks */
+    TEST_ASSERT_GREATER_OR_EQUAL(90, rr_ticks[0]);
+    TEST_ASSERT_EQUAL(0U, rr_ticks[1]);
+#endif
+
+    /* A member released in the group does not preempt the running member before its time slice ends */
+    rr_isr_task_woken = false;
+    rr_isr_release = true;
+    os_task_start(OS_TASK_RR_2);
+    os_delay(2);
+    os_task_stop(OS_TASK_RR_1);
+    os_task_stop(OS_TASK_RR_2);
+    TEST_ASSERT_FALSE(rr_isr_release);
+#if (BEERTOS_USE_ROUND_ROBIN == true)
+    TEST_ASSERT_FALSE(rr_isr_task_woken);
+#else
+    TEST_ASSERT_TRUE(rr_isr_task_woken);
+#endif
+}
@@ -0,0 +1,38 @@
+#include "ut_utils.h"
+#include "BeeRTOS_task.h"
+
+void TEST_bitmap(void)
+{
+    PRINT_UT_BEGIN();
+
+    os_task_mask_t mask;
+    const uint32_t lowest = 1U;
+    const uint32_t middle = OS_TASK_MAX / 2U;
+    const uint32_t highest = OS_TASK_MAX - 1U;
+
+    os_task_mask_reset(&mask);
+    TEST_ASSERT_TRUE(os_task_mask_is_empty(&mask));
+    TEST_ASSERT_EQUAL(0U, os_task_mask_get_highest_below(&mask, highest));
+
+    os_task_mask_set(&mask, lowest);
+    os_task_mask_set(&mask, middle);
+    os_task_mask_set(&mask, highest);
+    TEST_ASSERT_FALSE(os_task_mask_is_empty(&mask));
+    TEST_ASSERT_TRUE(os_task_mask_test(&mask, middle));
+    TEST_ASSERT_FALSE(os_task_mask_test(&mask, middle + 1U));
+
+    /* Highest priority and the highest priority at or below a limit */
+    TEST_ASSERT_EQUAL(highest, os_task_mask_get_highest(&mask));
+    TEST_ASSERT_EQUAL(highest, os_task_mask_get_highest_below(&mask, highest));
+    TEST_ASSERT_EQUAL(middle, os_task_mask_get_highest_below(&mask, highest - 1U));
+    TEST_ASSERT_EQUAL(middle, os_task_mask_get_highest_below(&mask, middle));
+    TEST_ASSERT_EQUAL(lowest, os_task_mask_get_highest_below(&mask, middle - 1U));
+    TEST_ASSERT_EQUAL(0U, os_task_mask_get_highest_below(&mask, 0U));
+
+    os_task_mask_clear(&mask, highest);
+    TEST_ASSERT_EQUAL(middle, os_task_mask_get_highest(&mask));
+    os_task_mask_clear(&mask, middle);
+    TEST_ASSERT_EQUAL(lowest, os_task_mask_get_highest(&mask));
+    os_task_mask_clear(&mask, lowest);
+    TEST_ASSERT_TRUE(os_task_mask_is_empty(&mask));
+}
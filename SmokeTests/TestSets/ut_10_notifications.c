@@ -0,0 +1,84 @@
+#include "ut_utils.h"
+
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+static volatile uint32_t notify_value;
+static volatile uint32_t notify_count;
+#endif /* BEERTOS_USE_TASK_NOTIFICATIONS */
+
+/* Also started by TEST_from_isr, so the task exists with the notifications disabled */
+void ut_task_notify(void *arg)
+{
+    (void)arg;
+
+    while (1)
+    {
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+        uint32_t value;
+
+        if (os_task_notify_wait(0xFFFFFFFFU, &value, 1000U))
+        {
+            notify_value = value;
+            notify_count++;
+        }
+#else
+        os_delay(1000U);
+#endif
+    }
+}
+
+void TEST_task_notifications(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    bool ret;
+    uint32_t value = 0U;
+
+    /* Notification of the current task, taken without blocking */
+    ret = os_task_notify_wait(0U, &value, 0U);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "No notification should be pending.");
+    ret = os_task_notify(OS_TASK_UT_MAIN, 3U, OS_TASK_NOTIFY_OVERWRITE);
+    TEST_ASSERT_TRUE(ret);
+    ret = os_task_notify_wait(0U, &value, 0U);
+    TEST_ASSERT_TRUE_MESSAGE(ret, "Notification should be pending.");
+    TEST_ASSERT_EQUAL(3U, value);
+    ret = os_task_notify_wait(0U, &value, 0U);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Notification should be taken.");
+
+    /* Task blocks in os_task_notify_wait */
+    os_task_start(OS_TASK_NOTIFY);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(0U, notify_count);
+
+    /* Set bits - the task is woken up */
+    ret = os_task_notify(OS_TASK_NOTIFY, 0x05U, OS_TASK_NOTIFY_SET_BITS);
+    TEST_ASSERT_TRUE(ret);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(1U, notify_count);
+    TEST_ASSERT_EQUAL(0x05U, notify_value);
+
+    /* Increment - the second notification is accumulated before the task runs */
+    os_task_notify(OS_TASK_NOTIFY, 0U, OS_TASK_NOTIFY_INCREMENT);
+    os_task_notify(OS_TASK_NOTIFY, 0U, OS_TASK_NOTIFY_INCREMENT);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(2U, notify_count);
+    TEST_ASSERT_EQUAL(2U, notify_value);
+
+    /* No overwrite fails while the previous notification is pending */
+    ret = os_task_notify(OS_TASK_NOTIFY, 7U, OS_TASK_NOTIFY_OVERWRITE);
+    TEST_ASSERT_TRUE(ret);
+    ret = os_task_notify(OS_TASK_NOTIFY, 9U, OS_TASK_NOTIFY_NO_OVERWRITE);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Pending notification should not be overwritten.");
+    os_delay(2);
+    TEST_ASSERT_EQUAL(3U, notify_count);
+    TEST_ASSERT_EQUAL(7U, notify_value);
+
+    /* Timeout */
+    value = os_get_tick_count();
+    ret = os_task_notify_wait(0U, NULL, 5U);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Wait should time out.");
+    TEST_ASSERT_EQUAL(value + 5U, os_get_tick_count());
+
+    os_task_stop(OS_TASK_NOTIFY);
+#endif /* BEERTOS_USE_TASK_NOTIFICATIONS */
+}
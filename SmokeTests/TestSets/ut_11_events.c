@@ -0,0 +1,78 @@
+#include "ut_utils.h"
+
+#define UT_EVENT_BITS_ALL   (0x03U)
+#define UT_EVENT_BITS_ANY   (0x0CU)
+
+static volatile uint32_t event_all_count;
+static volatile uint32_t event_any_count;
+static volatile uint32_t event_any_bits;
+
+void ut_task_event_all(void *arg)
+{
+    while (1)
+    {
+        const uint32_t bits = os_event_wait(EVENT_GROUP_UT, UT_EVENT_BITS_ALL,
+                                            OS_EVENT_WAIT_ALL, true, 1000U);
+        if ((bits & UT_EVENT_BITS_ALL) == UT_EVENT_BITS_ALL)
+        {
+            event_all_count++;
+        }
+    }
+}
+
+void ut_task_event_any(void *arg)
+{
+    while (1)
+    {
+        const uint32_t bits = os_event_wait(EVENT_GROUP_UT, UT_EVENT_BITS_ANY,
+                                            OS_EVENT_WAIT_ANY, false, 1000U);
+        if (bits & UT_EVENT_BITS_ANY)
+        {
+            event_any_bits = bits;
+            event_any_count++;
+            os_event_clear(EVENT_GROUP_UT, UT_EVENT_BITS_ANY);
+        }
+    }
+}
+
+void TEST_event_groups(void)
+{
+    PRINT_UT_BEGIN();
+
+    uint32_t bits;
+
+    os_task_start(OS_TASK_EVENT_ALL);
+    os_task_start(OS_TASK_EVENT_ANY);
+    os_delay(2);
+
+    /* Only one of the bits required by the wait-all task is set */
+    os_event_set(EVENT_GROUP_UT, 0x01U);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(0U, event_all_count);
+    TEST_ASSERT_EQUAL(0U, event_any_count);
+    TEST_ASSERT_EQUAL(0x01U, os_event_get(EVENT_GROUP_UT));
+
+    /* One set releases both waiters, the wait-all task clears its bits on exit */
+    bits = os_event_set(EVENT_GROUP_UT, 0x06U);
+    TEST_ASSERT_EQUAL(0x04U, bits);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(1U, event_all_count);
+    TEST_ASSERT_EQUAL(1U, event_any_count);
+    TEST_ASSERT_EQUAL(0x07U, event_any_bits);
+    TEST_ASSERT_EQUAL(0U, os_event_get(EVENT_GROUP_UT));
+
+    /* Condition already met, no blocking */
+    os_event_set(EVENT_GROUP_UT, 0x10U);
+    bits = os_event_wait(EVENT_GROUP_UT, 0x30U, OS_EVENT_WAIT_ANY, true, 0U);
+    TEST_ASSERT_EQUAL(0x10U, bits);
+    TEST_ASSERT_EQUAL(0U, os_event_get(EVENT_GROUP_UT));
+
+    /* Timeout */
+    const uint32_t start = os_get_tick_count();
+    bits = os_event_wait(EVENT_GROUP_UT, 0x30U, OS_EVENT_WAIT_ALL, false, 5U);
+    TEST_ASSERT_EQUAL(0U, bits);
+    TEST_ASSERT_EQUAL(start + 5U, os_get_tick_count());
+
+    os_task_stop(OS_TASK_EVENT_ALL);
+    os_task_stop(OS_TASK_EVENT_ANY);
+}
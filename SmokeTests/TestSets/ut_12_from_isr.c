@@ -0,0 +1,79 @@
+#include "ut_utils.h"
+
+static volatile bool isr_task_woken;
+static volatile bool isr_main_resumed;
+static volatile bool isr_main_resumed_before_yield;
+
+/* Emulates an interrupt handler preempting the lowest priority task */
+void ut_task_isr(void *arg)
+{
+    while (1)
+    {
+        bool task_woken = false;
+
+        /* Interrupts are masked in the handler, as on the target */
+        const os_crit_state_t state = os_port_enter_critical();
+
+        (void)os_semaphore_signal_from_isr(SEMAPHORE_ISR, &task_woken);
+        isr_task_woken = task_woken;
+        isr_main_resumed_before_yield = isr_main_resumed;
+        os_port_yield_from_isr(task_woken);
+
+        os_port_leave_critical(state);
+
+        os_task_stop(OS_TASK_ISR);
+    }
+}
+
+void TEST_from_isr(void)
+{
+    PRINT_UT_BEGIN();
+
+    bool task_woken = false;
+    bool ret;
+    uint32_t value = 0U;
+
+    /* Nothing is waiting for the semaphore, no context switch is needed */
+    ret = os_semaphore_signal_from_isr(SEMAPHORE_ISR, &task_woken);
+    TEST_ASSERT_TRUE(ret);
+    TEST_ASSERT_FALSE(task_woken);
+    ret = os_semaphore_signal_from_isr(SEMAPHORE_ISR, &task_woken);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Binary semaphore is already signaled.");
+    ret = os_semaphore_wait(SEMAPHORE_ISR, 0U);
+    TEST_ASSERT_TRUE(ret);
+
+    /* Lower priority task is started, the current task is not preempted */
+    ret = os_task_start_from_isr(OS_TASK_NOTIFY, &task_woken);
+    TEST_ASSERT_TRUE(ret);
+    TEST_ASSERT_FALSE(task_woken);
+    os_port_yield_from_isr(task_woken);
+    os_delay(2);
+#if (BEERTOS_USE_TASK_NOTIFICATIONS == true)
+    ret = os_task_notify_from_isr(OS_TASK_NOTIFY, 1U, OS_TASK_NOTIFY_OVERWRITE, &task_woken);
+    TEST_ASSERT_TRUE(ret);
+    TEST_ASSERT_FALSE(task_woken);
+#endif
+    os_task_stop(OS_TASK_NOTIFY);
+
+    /* Message functions never block in an interrupt */
+    value = 5U;
+    ret = os_message_send_from_isr(MESSAGE_TWO, &value, &task_woken);
+    TEST_ASSERT_TRUE(ret);
+    value = 0U;
+    ret = os_message_receive_from_isr(MESSAGE_TWO, &value, &task_woken);
+    TEST_ASSERT_TRUE(ret);
+    TEST_ASSERT_EQUAL(5U, value);
+    ret = os_message_receive_from_isr(MESSAGE_TWO, &value, &task_woken);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Message should be empty.");
+    TEST_ASSERT_FALSE(task_woken);
+
+    /* Interrupt preempting the lowest priority task releases this task - the context switch
+       is taken only after os_port_yield_from_isr() */
+    isr_main_resumed = false;
+    os_task_start(OS_TASK_ISR);
+    ret = os_semaphore_wait(SEMAPHORE_ISR, 10U);
+    isr_main_resumed = true;
+    TEST_ASSERT_TRUE_MESSAGE(ret, "Semaphore should be signaled from the interrupt.");
+    TEST_ASSERT_TRUE_MESSAGE(isr_task_woken, "Higher priority task should be woken.");
+    TEST_ASSERT_FALSE_MESSAGE(isr_main_resumed_before_yield, "Task should not run before the yield.");
+}
@@ -0,0 +1,71 @@
+#include "ut_utils.h"
+
+#if (BEERTOS_DEFER_MODULE_EN == true)
+
+static volatile uint32_t defer_count;
+static volatile uint32_t defer_sum;
+static volatile bool defer_in_order;
+
+static void ut_defer_work(void *arg)
+{
+    const uint32_t value = (uint32_t)(uintptr_t)arg;
+
+    /* Work is run in the order it was posted */
+    if (value != defer_count + 1U)
+    {
+        defer_in_order = false;
+    }
+    defer_count++;
+    defer_sum += value;
+}
+#endif /* BEERTOS_DEFER_MODULE_EN */
+
+void TEST_defer(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_DEFER_MODULE_EN == true)
+    bool task_woken = false;
+    bool ret;
+    os_crit_state_t state;
+
+    defer_count = 0U;
+    defer_sum = 0U;
+    defer_in_order = true;
+
+    /* Emulated interrupt posts three callbacks, the defer task has lower priority */
+    state = os_port_enter_critical();
+    for (uint32_t i = 1U; i <= 3U; i++)
+    {
+        ret = os_defer_from_isr(ut_defer_work, (void *)(uintptr_t)i, &task_woken);
+        TEST_ASSERT_TRUE(ret);
+    }
+    os_port_yield_from_isr(task_woken);
+    os_port_leave_critical(state);
+
+    TEST_ASSERT_FALSE_MESSAGE(task_woken, "Defer task has lower priority.");
+    TEST_ASSERT_EQUAL_MESSAGE(0U, defer_count, "Work should not run before the task is preempted.");
+
+    os_delay(1);
+    TEST_ASSERT_EQUAL(3U, defer_count);
+    TEST_ASSERT_EQUAL(6U, defer_sum);
+    TEST_ASSERT_TRUE(defer_in_order);
+
+    /* Full ring rejects the work */
+    defer_count = 0U;
+    defer_sum = 0U;
+    state = os_port_enter_critical();
+    for (uint32_t i = 1U; i <= BEERTOS_DEFER_QUEUE_SIZE; i++)
+    {
+        ret = os_defer_from_isr(ut_defer_work, (void *)(uintptr_t)i, NULL);
+        TEST_ASSERT_TRUE(ret);
+    }
+    ret = os_defer_from_isr(ut_defer_work, (void *)(uintptr_t)0U, NULL);
+    os_port_leave_critical(state);
+    TEST_ASSERT_FALSE_MESSAGE(ret, "Full ring should reject the work.");
+
+    os_delay(1);
+    TEST_ASSERT_EQUAL(BEERTOS_DEFER_QUEUE_SIZE, defer_count);
+    TEST_ASSERT_TRUE(defer_in_order);
+#endif
+}
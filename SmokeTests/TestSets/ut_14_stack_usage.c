@@ -0,0 +1,35 @@
+#include "ut_utils.h"
+
+void TEST_stack_high_water(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    os_task_stack_usage_t usage;
+    static os_task_stack_usage_t report[OS_TASK_MAX];
+
+    /* Size comes from BEERTOS_PRIORITY_LIST, used + free is always the size */
+    usage = os_task_get_stack_high_water(OS_TASK_NOTIFY);
+    TEST_ASSERT_EQUAL(128U * sizeof(os_stack_t), usage.size);
+    TEST_ASSERT_EQUAL(usage.size, usage.used + usage.free);
+    TEST_ASSERT_TRUE(usage.free > 0U);
+
+    /* Mutex slots have no stack */
+    usage = os_task_get_stack_high_water(PRIO_CELLING_TASK_MUTEX_ONE);
+    TEST_ASSERT_EQUAL(0U, usage.size);
+    TEST_ASSERT_EQUAL(0U, usage.used);
+
+    /* Let the idle task scan all the stacks */
+    os_delay(10);
+    os_task_get_stack_report(report);
+    TEST_ASSERT_EQUAL(BEERTOS_IDLE_TASK_STACK_SIZE * sizeof(os_stack_t), report[OS_TASK_IDLE].size);
+    for (uint32_t id = 0U; id < OS_TASK_MAX; id++)
+    {
+        TEST_ASSERT_EQUAL(report[id].size, report[id].used + report[id].free);
+    }
+
+    /* The idle task measured the same value as the direct scan */
+    usage = os_task_get_stack_high_water(OS_TASK_MSG_1);
+    TEST_ASSERT_EQUAL(usage.free, report[OS_TASK_MSG_1].free);
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
+}
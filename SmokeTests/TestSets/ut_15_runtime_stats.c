@@ -0,0 +1,37 @@
+#include "ut_utils.h"
+
+void TEST_runtime_stats(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    uint64_t runtime;
+    uint64_t idle;
+    uint32_t load;
+    uint32_t start;
+
+    /* Busy loop - the whole time is accounted to this task */
+    (void)os_get_cpu_load();
+    runtime = os_task_get_runtime(OS_TASK_UT_MAIN);
+    idle = os_task_get_runtime(OS_TASK_IDLE);
+    start = os_get_tick_count();
+    while (os_get_tick_count() < (start + 5U))
+    {
+    }
+    TEST_ASSERT_TRUE(os_task_get_runtime(OS_TASK_UT_MAIN) > runtime);
+    load = os_get_cpu_load();
+    TEST_ASSERT_TRUE_MESSAGE(load > 5000U, "Busy loop should load the CPU.");
+    TEST_ASSERT_TRUE(load <= 10000U);
+
+    /* Nothing runs during the delay, the time is accounted to the idle task */
+    runtime = os_task_get_runtime(OS_TASK_UT_MAIN);
+    os_delay(10);
+    TEST_ASSERT_TRUE(os_task_get_runtime(OS_TASK_IDLE) > idle);
+    TEST_ASSERT_TRUE(os_task_get_runtime(OS_TASK_IDLE) - idle > os_task_get_runtime(OS_TASK_UT_MAIN) - runtime);
+    load = os_get_cpu_load();
+    TEST_ASSERT_TRUE_MESSAGE(load < 5000U, "Idle CPU should not be loaded.");
+
+    /* Mutex slots have no task */
+    TEST_ASSERT_EQUAL(0U, os_task_get_runtime(PRIO_CELLING_TASK_MUTEX_ONE));
+#endif /* BEERTOS_USE_RUNTIME_STATS */
+}
@@ -0,0 +1,46 @@
+#include "ut_utils.h"
+
+#define UT_LATENCY_WAKEUPS (5U)
+
+void TEST_latency(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_LATENCY_STATS == true)
+    os_task_latency_t latency;
+    uint32_t last_wake_time;
+    uint32_t histogram_sum = 0U;
+
+    os_task_reset_latency(OS_TASK_UT_MAIN);
+    TEST_ASSERT_TRUE(os_task_get_latency(OS_TASK_UT_MAIN, &latency));
+    TEST_ASSERT_EQUAL(0U, latency.count);
+    TEST_ASSERT_EQUAL(UINT32_MAX, latency.min);
+    TEST_ASSERT_EQUAL(0U, latency.max);
+
+    /* Periodic wakeups - released by the tick interrupt, measured from its entry */
+    last_wake_time = os_get_tick_count();
+    for (uint32_t i = 0U; i < UT_LATENCY_WAKEUPS; i++)
+    {
+        (void)os_delay_until(&last_wake_time, 2U);
+    }
+
+    TEST_ASSERT_TRUE(os_task_get_latency(OS_TASK_UT_MAIN, &latency));
+    TEST_ASSERT_EQUAL(UT_LATENCY_WAKEUPS, latency.count);
+    TEST_ASSERT_TRUE(latency.min <= latency.last);
+    TEST_ASSERT_TRUE(latency.last <= latency.max);
+    TEST_ASSERT_TRUE_MESSAGE(latency.max > 0U, "Wakeup from the tick cannot be immediate.");
+    for (uint32_t i = 0U; i < BEERTOS_LATENCY_HISTOGRAM_BUCKETS; i++)
+    {
+        histogram_sum += latency.histogram[i];
+    }
+    TEST_ASSERT_EQUAL(latency.count, histogram_sum);
+
+    /* The running task is not released, busy waiting is not a wakeup */
+    ut_blocking_delay(2U);
+    TEST_ASSERT_TRUE(os_task_get_latency(OS_TASK_UT_MAIN, &latency));
+    TEST_ASSERT_EQUAL(UT_LATENCY_WAKEUPS, latency.count);
+
+    /* Mutex slots have no task */
+    TEST_ASSERT_FALSE(os_task_get_latency(PRIO_CELLING_TASK_MUTEX_ONE, &latency));
+#endif /* BEERTOS_USE_LATENCY_STATS */
+}
@@ -0,0 +1,57 @@
+#include <string.h>
+#include "ut_utils.h"
+#include "BeeRTOS_trace.h"
+
+/* Returns the index of the newest record of the event and task written after start, or UINT32_MAX */
+static uint32_t ut_trace_find(const uint32_t start, const os_trace_event_t event, const uint16_t id)
+{
+    for (uint32_t index = os_trace_buffer.head; index-- > start;)
+    {
+        const os_trace_record_t *const record = &os_trace_buffer.records[index % BEERTOS_TRACE_BUFFER_SIZE];
+
+        if ((record->event == event) && (record->id == id))
+        {
+            TEST_ASSERT_EQUAL((uint8_t)((index / BEERTOS_TRACE_BUFFER_SIZE) + 1U), record->lap);
+            return index;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+void TEST_trace(void)
+{
+    PRINT_UT_BEGIN();
+
+    uint32_t start;
+    uint32_t delayed;
+    uint32_t switched;
+
+    /* The header and the task names are filled before the scheduler is started */
+    TEST_ASSERT_EQUAL(OS_TRACE_MAGIC, os_trace_buffer.magic);
+    TEST_ASSERT_EQUAL(sizeof(os_trace_record_t), os_trace_buffer.record_size);
+    TEST_ASSERT_EQUAL(0, strcmp(os_trace_buffer.task_names[OS_TASK_UT_MAIN], "OS_TASK_UT_MAIN"));
+    TEST_ASSERT_EQUAL(0, strcmp(os_trace_buffer.task_names[OS_TASK_IDLE], "OS_TASK_IDLE"));
+
+    /* The delay is recorded before the switch to the idle task and back */
+    start = os_trace_buffer.head;
+    os_delay(2);
+    TEST_ASSERT_TRUE(os_trace_buffer.head > start);
+    TEST_ASSERT_TRUE_MESSAGE(os_trace_buffer.head - start < BEERTOS_TRACE_BUFFER_SIZE, "Trace buffer overrun.");
+    delayed = ut_trace_find(start, OS_TRACE_EVENT_TASK_DELAYED, OS_TASK_UT_MAIN);
+    switched = ut_trace_find(start, OS_TRACE_EVENT_TASK_SWITCHED, OS_TASK_UT_MAIN);
+    TEST_ASSERT_TRUE(UINT32_MAX != delayed);
+    TEST_ASSERT_TRUE(UINT32_MAX != switched);
+    TEST_ASSERT_TRUE(switched > delayed);
+    TEST_ASSERT_TRUE(UINT32_MAX != ut_trace_find(start, OS_TRACE_EVENT_TASK_SWITCHED, OS_TASK_IDLE));
+    TEST_ASSERT_TRUE(UINT32_MAX != ut_trace_find(start, OS_TRACE_EVENT_TASK_READY, OS_TASK_UT_MAIN));
+
+    /* Alarm events carry the alarm ID and the period */
+    start = os_trace_buffer.head;
+    os_alarm_start(ALARM_ONE, 5U, true);
+    os_alarm_cancel(ALARM_ONE);
+    const uint32_t alarm = ut_trace_find(start, OS_TRACE_EVENT_ALARM_START_PERIODIC, ALARM_ONE);
+    TEST_ASSERT_TRUE(UINT32_MAX != alarm);
+    TEST_ASSERT_EQUAL(5U, os_trace_buffer.records[alarm % BEERTOS_TRACE_BUFFER_SIZE].arg);
+    TEST_ASSERT_TRUE(UINT32_MAX != ut_trace_find(start, OS_TRACE_EVENT_ALARM_CANCEL, ALARM_ONE));
+}
@@ -0,0 +1,75 @@
+#include "ut_utils.h"
+#include "BeeRTOS_footprint.h"
+
+#if (BEERTOS_USE_TASK_POOL == true)
+/* Levels of the BEERTOS_POOL_TASK entries, they have no task control block */
+#define UT_FOOTPRINT_POOL_LEVELS (3U)
+#else
+#define UT_FOOTPRINT_POOL_LEVELS (0U)
+#endif
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+/* The macros are constant expressions */
+static uint8_t ut_footprint_stacks[OS_FOOTPRINT_STACK_BYTES];
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
+
+void TEST_footprint(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    static os_task_stack_usage_t report[OS_TASK_MAX];
+    uint32_t stack_bytes = 0U;
+    uint32_t tasks = 0U;
+
+    /* Stacks match the stack sizes of the kernel */
+    os_task_get_stack_report(report);
+    for (uint32_t id = 0U; id < OS_TASK_MAX; id++)
+    {
+        if (report[id].size > 0U)
+        {
+            stack_bytes += report[id].size + OS_TASK_STACK_GUARD_SIZE;
+            tasks++;
+        }
+    }
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    /* Basic tasks have one shared stack */
+    stack_bytes += BEERTOS_BASIC_TASK_STACK_SIZE * sizeof(os_stack_t);
+    tasks += OS_BASIC_TASK_COUNT;
+#endif
+    TEST_ASSERT_EQUAL(sizeof(ut_footprint_stacks), stack_bytes);
+    TEST_ASSERT_EQUAL(OS_FOOTPRINT_STACK_BYTES, os_footprint.stacks.bytes);
+
+    /* Every priority level is a task, a mutex or one of the pool task levels */
+    TEST_ASSERT_EQUAL(tasks, os_footprint.tcbs.count);
+    TEST_ASSERT_EQUAL(OS_TASK_MAX, os_footprint.tcbs.count + BEERTOS_MUTEX_ID_MAX + UT_FOOTPRINT_POOL_LEVELS);
+    TEST_ASSERT_EQUAL(tasks * sizeof(os_task_t), os_footprint.tcbs.bytes);
+#endif /* BEERTOS_USE_STACK_HIGH_WATER */
+
+#if (BEERTOS_USE_TASK_POOL == true)
+    /* Pool slots follow BEERTOS_TASK_POOL_LIST, the stacks are not counted in the task stacks */
+    TEST_ASSERT_EQUAL(3U, os_footprint.task_pool.count);
+    TEST_ASSERT_TRUE(os_footprint.task_pool.bytes > ((2U * 128U) + 256U) * sizeof(os_stack_t));
+#endif
+
+    /* Buffers follow OS_MESSAGES_LIST and BEERTOS_QUEUE_LIST in BeeRTOS_cfg.h */
+    TEST_ASSERT_EQUAL((2U * 8U) + (10U * 4U) + (10U * 4U) + (1U * 4U), os_footprint.message_buffers.bytes);
+    TEST_ASSERT_EQUAL(10U + 10U, os_footprint.queue_buffers.bytes);
+
+    /* Semaphores and event groups hold one task mask, messages two */
+    TEST_ASSERT_EQUAL(sizeof(os_task_mask_t), os_footprint.task_mask_bytes);
+    TEST_ASSERT_EQUAL(sizeof(os_task_mask_t), os_footprint.semaphores.mask_bytes);
+    TEST_ASSERT_EQUAL(2U * sizeof(os_task_mask_t), os_footprint.messages.mask_bytes);
+
+    /* Total is the sum of all the entries */
+    const os_footprint_entry_t *const entries = &os_footprint.stacks;
+    const uint32_t count = (sizeof(os_footprint_t) - offsetof(os_footprint_t, stacks)) / sizeof(os_footprint_entry_t);
+    uint32_t total = 0U;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        total += entries[i].bytes;
+    }
+    TEST_ASSERT_EQUAL(OS_FOOTPRINT_RAM_TOTAL, total);
+    TEST_ASSERT_EQUAL(total, os_footprint.ram_total);
+    TEST_ASSERT_EQUAL(sizeof(os_footprint_t), os_footprint.size);
+}
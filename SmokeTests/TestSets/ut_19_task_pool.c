@@ -0,0 +1,56 @@
+#include "ut_utils.h"
+
+#if (BEERTOS_USE_TASK_POOL == true)
+
+static volatile uint32_t ut_pool_runs;
+
+/* Worker - counts its runs and returns its slot to the pool */
+static void ut_pool_worker(void *arg)
+{
+    ut_pool_runs += (uint32_t)(uintptr_t)arg;
+    os_task_delete();
+}
+#endif /* BEERTOS_USE_TASK_POOL */
+
+void TEST_task_pool(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_TASK_POOL == true)
+    ut_pool_runs = 0U;
+
+    /* Both small slots are taken, the pool tasks have lower priority than this task */
+    TEST_ASSERT_TRUE(os_task_create_dynamic(ut_pool_worker, (void *)1, OS_STACK_CLASS_SMALL, OS_TASK_POOL_1));
+    TEST_ASSERT_TRUE(os_task_create_dynamic(ut_pool_worker, (void *)1, OS_STACK_CLASS_SMALL, OS_TASK_POOL_2));
+    TEST_ASSERT_EQUAL(0U, ut_pool_runs);
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    TEST_ASSERT_EQUAL(128U * sizeof(os_stack_t), os_task_get_stack_high_water(OS_TASK_POOL_1).size);
+#endif
+
+    /* No small slot is free, the priority level is used */
+    TEST_ASSERT_FALSE(os_task_create_dynamic(ut_pool_worker, (void *)1, OS_STACK_CLASS_SMALL, OS_TASK_POOL_3));
+    TEST_ASSERT_FALSE(os_task_create_dynamic(ut_pool_worker, (void *)1, OS_STACK_CLASS_LARGE, OS_TASK_POOL_1));
+
+    /* Workers run and delete themselves, the slots and the levels are free again */
+    os_delay(2);
+    TEST_ASSERT_EQUAL(2U, ut_pool_runs);
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    TEST_ASSERT_EQUAL(0U, os_task_get_stack_high_water(OS_TASK_POOL_1).size);
+#endif
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    TEST_ASSERT_EQUAL(0U, os_task_get_runtime(OS_TASK_POOL_2));
+#endif
+
+    /* More tasks than slots over time - the slots are reused */
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        TEST_ASSERT_TRUE(os_task_create_dynamic(ut_pool_worker, (void *)10, OS_STACK_CLASS_SMALL, OS_TASK_POOL_3));
+        TEST_ASSERT_TRUE(os_task_create_dynamic(ut_pool_worker, (void *)100, OS_STACK_CLASS_LARGE, OS_TASK_POOL_1));
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+        TEST_ASSERT_EQUAL(256U * sizeof(os_stack_t), os_task_get_stack_high_water(OS_TASK_POOL_1).size);
+#endif
+        os_delay(2);
+    }
+    TEST_ASSERT_EQUAL(2U + (5U * 110U), ut_pool_runs);
+#endif /* BEERTOS_USE_TASK_POOL */
+}
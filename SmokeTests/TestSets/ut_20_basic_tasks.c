@@ -0,0 +1,88 @@
+#include "ut_utils.h"
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+
+#define UT_BASIC_RUNS (20U)
+
+static volatile uint32_t ut_basic_log[4];
+static volatile uint32_t ut_basic_log_count;
+static volatile bool ut_basic_nested;
+static volatile bool ut_basic_reactivated;
+
+static void ut_basic_log_check(const uint32_t first, const uint32_t second, const uint32_t third, const uint32_t fourth)
+{
+    TEST_ASSERT_EQUAL(4U, ut_basic_log_count);
+    TEST_ASSERT_EQUAL(first, ut_basic_log[0]);
+    TEST_ASSERT_EQUAL(second, ut_basic_log[1]);
+    TEST_ASSERT_EQUAL(third, ut_basic_log[2]);
+    TEST_ASSERT_EQUAL(fourth, ut_basic_log[3]);
+    ut_basic_log_count = 0U;
+}
+
+/* Basic task - logs its start (10 * arg) and end (10 * arg + 1), task 1 can activate task 2 */
+void ut_basic_task(void *arg)
+{
+    const uint32_t n = (uint32_t)(uintptr_t)arg;
+
+    ut_basic_log[ut_basic_log_count++] = n * 10U;
+    if ((1U == n) && ut_basic_nested)
+    {
+        /* Task 2 preempts this task and runs to completion */
+        (void)os_task_start(OS_TASK_BASIC_2);
+        /* This task runs, the activation is not queued */
+        ut_basic_reactivated = os_task_start(OS_TASK_BASIC_1);
+    }
+    ut_basic_log[ut_basic_log_count++] = (n * 10U) + 1U;
+}
+#endif /* BEERTOS_USE_BASIC_TASKS */
+
+void TEST_basic_tasks(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_BASIC_TASKS == true)
+    ut_basic_log_count = 0U;
+    ut_basic_nested = false;
+
+    /* Basic tasks have lower priority than this task, task 2 runs first, task 1 is dispatched
+       when task 2 completes - in place of it, the chain is not deeper */
+    for (uint32_t i = 0U; i < UT_BASIC_RUNS; i++)
+    {
+        const os_crit_state_t crit_state = os_enter_critical_section();
+        TEST_ASSERT_TRUE(os_task_start(OS_TASK_BASIC_1));
+        TEST_ASSERT_TRUE(os_task_start(OS_TASK_BASIC_2));
+        os_leave_critical_section(crit_state);
+
+        /* Activated, but not completed yet */
+        TEST_ASSERT_FALSE(os_task_start(OS_TASK_BASIC_1));
+        TEST_ASSERT_EQUAL(0U, ut_basic_log_count);
+
+        os_delay(1);
+        ut_basic_log_check(20U, 21U, 10U, 11U);
+    }
+    TEST_ASSERT_EQUAL(96U * sizeof(os_stack_t), os_task_get_basic_stack_peak());
+
+    /* Task 2 preempts task 1, it is placed below task 1 on the shared stack */
+    ut_basic_nested = true;
+    ut_basic_reactivated = true;
+    TEST_ASSERT_TRUE(os_task_start(OS_TASK_BASIC_1));
+    os_delay(1);
+    ut_basic_log_check(10U, 20U, 21U, 11U);
+    TEST_ASSERT_FALSE(ut_basic_reactivated);
+    TEST_ASSERT_EQUAL(2U * 96U * sizeof(os_stack_t), os_task_get_basic_stack_peak());
+
+    /* An activation which was not dispatched yet can be cancelled */
+    TEST_ASSERT_TRUE(os_task_start(OS_TASK_BASIC_2));
+    TEST_ASSERT_TRUE(os_task_stop(OS_TASK_BASIC_2));
+    os_delay(1);
+    TEST_ASSERT_EQUAL(0U, ut_basic_log_count);
+
+#if (BEERTOS_USE_STACK_HIGH_WATER == true)
+    /* Basic tasks have no stack of their own */
+    TEST_ASSERT_EQUAL(0U, os_task_get_stack_high_water(OS_TASK_BASIC_1).size);
+#endif
+#if (BEERTOS_USE_RUNTIME_STATS == true)
+    TEST_ASSERT_TRUE(os_task_get_runtime(OS_TASK_BASIC_1) > 0U);
+#endif
+#endif /* BEERTOS_USE_BASIC_TASKS */
+}
@@ -0,0 +1,87 @@
+#include "ut_utils.h"
+
+static volatile uint32_t ut_threshold_log[5];
+static volatile uint32_t ut_threshold_log_count;
+/* The middle task is released from an emulated interrupt instead of the lowest task */
+static volatile bool ut_threshold_from_isr;
+static volatile bool ut_threshold_task_woken;
+
+/* Task ids by the argument of the task function */
+static const os_task_id_t ut_threshold_tasks[] = {OS_TASK_IDLE, OS_TASK_PT_LOW, OS_TASK_PT_MID, OS_TASK_PT_HIGH};
+
+/* Logs 10 * arg on each run, the lowest task (threshold OS_TASK_PT_MID) starts the other two */
+void ut_threshold_task(void *arg)
+{
+    const uint32_t n = (uint32_t)(uintptr_t)arg;
+
+    while (1)
+    {
+        ut_threshold_log[ut_threshold_log_count++] = n * 10U;
+        if (1U == n)
+        {
+            /* Below the threshold - does not preempt this task */
+            if (ut_threshold_from_isr)
+            {
+                bool task_woken = false;
+                const os_crit_state_t state = os_port_enter_critical();
+
+                (void)os_task_start_from_isr(OS_TASK_PT_MID, &task_woken);
+                ut_threshold_task_woken = task_woken;
+                os_port_yield_from_isr(task_woken);
+
+                os_port_leave_critical(state);
+            }
+            else
+            {
+                os_task_start(OS_TASK_PT_MID);
+            }
+            ut_threshold_log[ut_threshold_log_count++] = 11U;
+            /* Above the threshold - preempts this task */
+            os_task_start(OS_TASK_PT_HIGH);
+            ut_threshold_log[ut_threshold_log_count++] = 12U;
+        }
+        os_task_stop(ut_threshold_tasks[n]);
+    }
+}
+
+void TEST_preemption_threshold(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    const uint32_t expected[] = {10U, 11U, 30U, 12U, 20U};
+#else
+    /* Without the threshold the lowest task is preempted by both */
+    const uint32_t expected[] = {10U, 20U, 11U, 30U, 12U};
+#endif
+
+    for (uint32_t run = 0U; run < 4U; run++)
+    {
+        ut_threshold_log_count = 0U;
+        ut_threshold_from_isr = (3U == run);
+        ut_threshold_task_woken = false;
+        os_task_start(OS_TASK_PT_LOW);
+        os_delay(2);
+
+        TEST_ASSERT_EQUAL(5U, ut_threshold_log_count);
+        for (uint32_t i = 0U; i < 5U; i++)
+        {
+            TEST_ASSERT_EQUAL(expected[i], ut_threshold_log[i]);
+        }
+    }
+
+    /* The interrupt requests no context switch for a task below the threshold */
+#if (BEERTOS_USE_PREEMPTION_THRESHOLD == true)
+    TEST_ASSERT_FALSE(ut_threshold_task_woken);
+#else
+    TEST_ASSERT_TRUE(ut_threshold_task_woken);
+#endif
+    ut_threshold_from_isr = false;
+
+    /* The threshold applies only while the lowest task runs */
+    ut_threshold_log_count = 0U;
+    os_task_start(OS_TASK_PT_MID);
+    os_delay(2);
+    TEST_ASSERT_EQUAL(1U, ut_threshold_log_count);
+    TEST_ASSERT_EQUAL(20U, ut_threshold_log[0]);
+}
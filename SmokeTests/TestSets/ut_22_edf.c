@@ -0,0 +1,76 @@
+#include "ut_utils.h"
+
+static volatile uint32_t ut_edf_log[3];
+static volatile uint32_t ut_edf_log_count;
+static volatile bool ut_edf_nested;
+
+/* Task ids by the argument of the task function */
+static const os_task_id_t ut_edf_tasks[] = {OS_TASK_IDLE, OS_TASK_EDF_1, OS_TASK_EDF_2};
+
+/* Logs 10 * arg on each run, task 2 (deadline 10) can start task 1 (deadline 50) */
+void ut_edf_task(void *arg)
+{
+    const uint32_t n = (uint32_t)(uintptr_t)arg;
+
+    while (1)
+    {
+        ut_edf_log[ut_edf_log_count++] = n * 10U;
+        if ((2U == n) && ut_edf_nested)
+        {
+            /* Task 1 is listed first, but its deadline is later */
+            os_task_start(OS_TASK_EDF_1);
+            ut_edf_log[ut_edf_log_count++] = 21U;
+        }
+        os_task_stop(ut_edf_tasks[n]);
+    }
+}
+
+static void ut_edf_check(const uint32_t *const expected, const uint32_t count)
+{
+    TEST_ASSERT_EQUAL(count, ut_edf_log_count);
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        TEST_ASSERT_EQUAL(expected[i], ut_edf_log[i]);
+    }
+    ut_edf_log_count = 0U;
+}
+
+void TEST_edf(void)
+{
+    PRINT_UT_BEGIN();
+
+#if (BEERTOS_USE_EDF == true)
+    const uint32_t expected_both[] = {20U, 10U};
+    const uint32_t expected_nested[] = {20U, 21U, 10U};
+#else
+    /* Without EDF the tasks run by their order in the list */
+    const uint32_t expected_both[] = {10U, 20U};
+    const uint32_t expected_nested[] = {20U, 10U, 21U};
+#endif
+
+    /* Both released at the same tick - the earlier absolute deadline runs first */
+    ut_edf_log_count = 0U;
+    ut_edf_nested = false;
+    const os_crit_state_t crit_state = os_enter_critical_section();
+    os_task_start(OS_TASK_EDF_1);
+    os_task_start(OS_TASK_EDF_2);
+    os_leave_critical_section(crit_state);
+    os_delay(2);
+    ut_edf_check(expected_both, 2U);
+
+    /* A task released with a later deadline does not preempt the running one */
+    ut_edf_nested = true;
+    os_task_start(OS_TASK_EDF_2);
+    os_delay(2);
+    ut_edf_check(expected_nested, 3U);
+    ut_edf_nested = false;
+
+    /* The deadline is counted from the release - task 1 released 45 ticks before task 2
+       has the earlier absolute deadline (50 < 45 + 10) */
+    const uint32_t expected_released[] = {10U, 20U};
+    os_task_start(OS_TASK_EDF_1);
+    ut_blocking_delay(45);
+    os_task_start(OS_TASK_EDF_2);
+    os_delay(2);
+    ut_edf_check(expected_released, 2U);
+}
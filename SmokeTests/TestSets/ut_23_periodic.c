@@ -0,0 +1,101 @@
+#include "ut_utils.h"
+
+/* OS_TASK_PERIODIC - period 10, offset 3, deadline 4 */
+#define UT_PERIODIC_PERIOD (10U)
+#define UT_PERIODIC_OFFSET (3U)
+#define UT_PERIODIC_DEADLINE (4U)
+
+static volatile uint32_t ut_periodic_release[4];
+static volatile uint32_t ut_periodic_release_count;
+static volatile bool ut_periodic_log;
+static volatile uint32_t ut_periodic_overrun;
+static volatile uint32_t ut_periodic_misses;
+static volatile uint32_t ut_periodic_miss_response;
+
+/* Job of the periodic test task - logs the tick of its start, can run longer than the deadline */
+void ut_periodic_job(void)
+{
+    if (ut_periodic_log && (ut_periodic_release_count < 4U))
+    {
+        ut_periodic_release[ut_periodic_release_count++] = os_get_tick_count();
+    }
+    if (ut_periodic_overrun > 0U)
+    {
+        ut_blocking_delay(ut_periodic_overrun);
+        ut_periodic_overrun = 0U;
+    }
+}
+
+void ut_deadline_miss_cb(uint32_t task_id, uint32_t response_time)
+{
+    if (OS_TASK_PERIODIC == task_id)
+    {
+        ut_periodic_misses++;
+        ut_periodic_miss_response = response_time;
+    }
+}
+
+/* Logs the releases during the given ticks, all of them must keep the phase of the task */
+static void ut_periodic_check_releases(const uint32_t ticks)
+{
+    ut_periodic_release_count = 0U;
+    ut_periodic_log = true;
+    os_delay(ticks);
+    ut_periodic_log = false;
+
+    TEST_ASSERT_TRUE(ut_periodic_release_count >= (ticks / UT_PERIODIC_PERIOD) - 1U);
+    for (uint32_t i = 0U; i < ut_periodic_release_count; i++)
+    {
+        TEST_ASSERT_EQUAL(0U, (ut_periodic_release[i] - UT_PERIODIC_OFFSET) % UT_PERIODIC_PERIOD);
+        if (i > 0U)
+        {
+            TEST_ASSERT_EQUAL(UT_PERIODIC_PERIOD, ut_periodic_release[i] - ut_periodic_release[i - 1U]);
+        }
+    }
+}
+
+void TEST_periodic(void)
+{
+    PRINT_UT_BEGIN();
+
+    os_task_periodic_stats_t stats;
+
+    /* Only periodic tasks have the statistics */
+    TEST_ASSERT_FALSE(os_task_get_periodic_stats(OS_TASK_UT_MAIN, &stats));
+
+    /* The previous tests could delay the jobs, start from clean statistics */
+    os_delay(2U * UT_PERIODIC_PERIOD);
+    os_task_reset_periodic_stats(OS_TASK_PERIODIC);
+    TEST_ASSERT_TRUE(os_task_get_periodic_stats(OS_TASK_PERIODIC, &stats));
+    TEST_ASSERT_EQUAL(0U, stats.jobs);
+    ut_periodic_misses = 0U;
+
+    /* The jobs are released at offset + n * period */
+    ut_periodic_check_releases(3U * UT_PERIODIC_PERIOD);
+    TEST_ASSERT_TRUE(os_task_get_periodic_stats(OS_TASK_PERIODIC, &stats));
+    TEST_ASSERT_TRUE(stats.jobs >= 2U);
+    TEST_ASSERT_EQUAL(0U, stats.misses);
+    TEST_ASSERT_TRUE(stats.response_max < UT_PERIODIC_DEADLINE);
+    TEST_ASSERT_EQUAL(0U, ut_periodic_misses);
+
+    /* A job running 6 ticks misses the deadline of 4 ticks */
+    ut_periodic_overrun = 6U;
+    os_delay(2U * UT_PERIODIC_PERIOD);
+    TEST_ASSERT_EQUAL(0U, ut_periodic_overrun);
+    TEST_ASSERT_TRUE(os_task_get_periodic_stats(OS_TASK_PERIODIC, &stats));
+    TEST_ASSERT_EQUAL(1U, stats.misses);
+    TEST_ASSERT_TRUE(stats.response_max >= 6U);
+    TEST_ASSERT_TRUE(stats.response_mean <= stats.response_max);
+    TEST_ASSERT_TRUE(stats.response_mean >= (stats.response_max / stats.jobs));
+    TEST_ASSERT_EQUAL(1U, ut_periodic_misses);
+    TEST_ASSERT_EQUAL(stats.response_max, ut_periodic_miss_response);
+
+    /* The overrun does not shift the following releases */
+    ut_periodic_check_releases(3U * UT_PERIODIC_PERIOD);
+
+    os_task_reset_periodic_stats(OS_TASK_PERIODIC);
+    TEST_ASSERT_TRUE(os_task_get_periodic_stats(OS_TASK_PERIODIC, &stats));
+    TEST_ASSERT_EQUAL(0U, stats.jobs);
+    TEST_ASSERT_EQUAL(0U, stats.misses);
+    TEST_ASSERT_EQUAL(0U, stats.response_max);
+}
@@ -0,0 +1,127 @@
+#include "ut_utils.h"
+
+/* Check-in periods, the tasks check in twice per period */
+#define UT_WDG_TASK_PERIOD (4U)
+#define UT_WDG_MAIN_PERIOD (10U)
+
+static volatile bool ut_wdg_task_hung;
+static volatile bool ut_wdg_task_done;
+static volatile uint32_t ut_wdg_misses;
+static volatile uint32_t ut_wdg_miss_id;
+static volatile uint32_t ut_wdg_miss_tick;
+static volatile uint32_t ut_wdg_feeds;
+
+/* Registered task - checks in until it is hung (keeps running, but does not check in) */
+void ut_wdg_task(void *arg)
+{
+    (void)arg;
+
+    while (1)
+    {
+        os_wdg_register(UT_WDG_TASK_PERIOD);
+        while (!ut_wdg_task_done)
+        {
+            if (!ut_wdg_task_hung)
+            {
+                os_wdg_kick();
+            }
+            os_delay(UT_WDG_TASK_PERIOD / 2U);
+        }
+        os_wdg_unregister();
+        os_task_stop(OS_TASK_WDG);
+    }
+}
+
+void ut_wdg_miss_cb(uint32_t task_id)
+{
+    ut_wdg_misses++;
+    ut_wdg_miss_id = task_id;
+    ut_wdg_miss_tick = os_get_tick_count();
+}
+
+void ut_wdg_feed(void)
+{
+    ut_wdg_feeds++;
+}
+
+#if (BEERTOS_USE_TICKLESS_IDLE == true)
+/* The tick is suppressed while only the idle task runs, the hardware watchdog is fed once per wakeup */
+#define UT_WDG_MIN_FEEDS(ticks) (1U)
+#else
+/* The hardware watchdog is fed on every tick */
+#define UT_WDG_MIN_FEEDS(ticks) (ticks)
+#endif
+
+/* Delays the main task, which checks in after each half of its period */
+static void ut_wdg_main_delay(const uint32_t periods)
+{
+    for (uint32_t i = 0U; i < (2U * periods); i++)
+    {
+        os_delay(UT_WDG_MAIN_PERIOD / 2U);
+        os_wdg_kick();
+    }
+}
+
+void TEST_wdg(void)
+{
+    PRINT_UT_BEGIN();
+
+    ut_wdg_misses = 0U;
+    ut_wdg_task_hung = false;
+    ut_wdg_task_done = false;
+
+    os_wdg_register(UT_WDG_MAIN_PERIOD);
+    os_task_start(OS_TASK_WDG);
+
+    /* Both tasks check in, the hardware watchdog is fed */
+    uint32_t feeds = ut_wdg_feeds;
+    ut_wdg_main_delay(3U);
+    TEST_ASSERT_EQUAL(0U, ut_wdg_misses);
+    TEST_ASSERT_TRUE((ut_wdg_feeds - feeds) >= UT_WDG_MIN_FEEDS(3U * UT_WDG_MAIN_PERIOD));
+    TEST_ASSERT_FALSE(os_wdg_is_expired(OS_TASK_WDG));
+
+    /* The task stops checking in - reported once, the hardware watchdog is not fed */
+    ut_wdg_task_hung = true;
+    ut_wdg_main_delay(1U);
+    TEST_ASSERT_EQUAL(1U, ut_wdg_misses);
+    TEST_ASSERT_EQUAL(OS_TASK_WDG, ut_wdg_miss_id);
+    TEST_ASSERT_TRUE(os_wdg_is_expired(OS_TASK_WDG));
+    TEST_ASSERT_FALSE(os_wdg_is_expired(OS_TASK_UT_MAIN));
+
+    feeds = ut_wdg_feeds;
+    ut_wdg_main_delay(1U);
+    TEST_ASSERT_EQUAL(feeds, ut_wdg_feeds);
+    TEST_ASSERT_EQUAL(1U, ut_wdg_misses);
+
+    /* The task checks in again, the hardware watchdog is fed again */
+    ut_wdg_task_hung = false;
+    ut_wdg_main_delay(1U);
+    TEST_ASSERT_FALSE(os_wdg_is_expired(OS_TASK_WDG));
+    feeds = ut_wdg_feeds;
+    ut_wdg_main_delay(1U);
+    TEST_ASSERT_TRUE((ut_wdg_feeds - feeds) >= UT_WDG_MIN_FEEDS(UT_WDG_MAIN_PERIOD));
+    TEST_ASSERT_EQUAL(1U, ut_wdg_misses);
+
+    /* Unregistered tasks are not checked */
+    ut_wdg_task_done = true;
+    ut_wdg_main_delay(1U);
+    os_wdg_unregister();
+    os_delay(3U * UT_WDG_MAIN_PERIOD);
+    TEST_ASSERT_EQUAL(1U, ut_wdg_misses);
+    TEST_ASSERT_FALSE(os_wdg_is_expired(OS_TASK_UT_MAIN));
+
+    /* A blocked task is reported on the tick after its deadline while only the idle task runs
+       (the tickless idle mode must not sleep past the check). Registered between the releases
+       of OS_TASK_PERIODIC (offset 3, period 10), whose wakeups do not coincide with the check */
+    while (5U != (os_get_tick_count() % UT_WDG_MAIN_PERIOD))
+    {
+        os_delay(1U);
+    }
+    const uint32_t start = os_get_tick_count();
+    os_wdg_register(UT_WDG_MAIN_PERIOD);
+    os_delay(3U * UT_WDG_MAIN_PERIOD);
+    TEST_ASSERT_EQUAL(2U, ut_wdg_misses);
+    TEST_ASSERT_EQUAL(OS_TASK_UT_MAIN, ut_wdg_miss_id);
+    TEST_ASSERT_EQUAL(start + UT_WDG_MAIN_PERIOD + 1U, ut_wdg_miss_tick);
+    os_wdg_unregister();
+}
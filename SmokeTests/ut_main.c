@@ -1,5 +1,8 @@
 #include "unity.h"
 #include "BeeRTOS.h"
+#if defined(__unix__)
+#include <stdlib.h>
+#endif
 
 extern void TEST_delay(void);
 extern void TEST_rtos_task_core(void);
@@ -8,6 +11,26 @@ extern void TEST_alarms(void);
 extern void TEST_mutexes(void);
 extern void TEST_messages(void);
 extern void TEST_queues(void);
+extern void TEST_delay_until(void);
+extern void TEST_round_robin(void);
+extern void TEST_bitmap(void);
+extern void TEST_task_notifications(void);
+extern void TEST_event_groups(void);
+extern void TEST_from_isr(void);
+extern void TEST_defer(void);
+extern void TEST_stack_high_water(void);
+extern void TEST_runtime_stats(void);
+extern void TEST_latency(void);
+extern void TEST_trace(void);
+extern void TEST_footprint(void);
+extern void TEST_task_pool(void);
+extern void TEST_basic_tasks(void);
+extern void TEST_preemption_threshold(void);
+extern void TEST_edf(void);
+extern void TEST_periodic(void);
+extern void TEST_wdg(void);
+extern void TEST_benchmarks(void);
+extern void TEST_benchmarks_sched(void);
 
 void (*test_functions[])(void) = {
     TEST_delay,
@@ -17,6 +40,26 @@ void (*test_functions[])(void) = {
     TEST_mutexes,
     TEST_messages,
     TEST_queues,
+    TEST_delay_until,
+    TEST_round_robin,
+    TEST_bitmap,
+    TEST_task_notifications,
+    TEST_event_groups,
+    TEST_from_isr,
+    TEST_defer,
+    TEST_stack_high_water,
+    TEST_runtime_stats,
+    TEST_latency,
+    TEST_trace,
+    TEST_footprint,
+    TEST_task_pool,
+    TEST_basic_tasks,
+    TEST_preemption_threshold,
+    TEST_edf,
+    TEST_periodic,
+    TEST_wdg,
+    TEST_benchmarks,
+    TEST_benchmarks_sched,
 };
 
 void ut_beertos_main_task(void *arg)
@@ -28,7 +71,14 @@ void ut_beertos_main_task(void *arg)
         RUN_TEST(test_functions[i]);
     }
 
-    UnityEnd();
+    const int failures = UnityEnd();
+
+#if defined(__unix__)
+    /* Host build (POSIX port) - the process ends with the result, so it can gate CI */
+    exit((0 != failures) ? EXIT_FAILURE : EXIT_SUCCESS);
+#else
+    (void)failures;
+#endif
 
     os_task_delete();
 
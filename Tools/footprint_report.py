@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Print the RAM footprint of a BeeRTOS configuration (os_footprint).
+
+The report is read from an object file or ELF image containing os_footprint, e.g. the
+BeeRTOS_footprint.o of the build, so nothing has to run on the target. With --cc the file
+BeeRTOS/Src/BeeRTOS_footprint.c is compiled first, the remaining arguments are passed to
+the compiler (the include paths of the configuration).
+
+Usage: footprint_report.py BeeRTOS_footprint.o [--tools-prefix arm-none-eabi-] [--csv]
+       footprint_report.py --cc arm-none-eabi-gcc -- -IBeeRTOS/Cfg -IBeeRTOS/Src ...
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+HEADER = struct.Struct('5I')
+ENTRY = struct.Struct('4I')
+
+# Keep in sync with os_footprint_t in BeeRTOS_footprint.h
+ENTRIES = [
+    'stacks',
+    'tcbs',
+    'task_pool',
+    'scheduler',
+    'queues',
+    'queue_buffers',
+    'messages',
+    'message_buffers',
+    'semaphores',
+    'mutexes',
+    'alarms',
+    'event_groups',
+    'event_waiters',
+    'defer',
+    'wdg',
+    'trace',
+    'assert_log',
+]
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'BeeRTOS', 'Src', 'BeeRTOS_footprint.c')
+
+
+def read_symbol(path, prefix, symbol='os_footprint'):
+    """Returns the bytes of the symbol, found with objdump and extracted with objcopy."""
+    table = subprocess.run([prefix + 'objdump', '-t', path], check=True, capture_output=True, text=True).stdout
+    for line in table.splitlines():
+        fields = line.split()
+        if fields and fields[-1] == symbol:
+            value, section, size = int(fields[0], 16), fields[-3], int(fields[-2], 16)
+            break
+    else:
+        sys.exit('%s not found in %s' % (symbol, path))
+
+    headers = subprocess.run([prefix + 'objdump', '-h', path], check=True, capture_output=True, text=True).stdout
+    address = next(int(fields[3], 16) for fields in map(str.split, headers.splitlines())
+                   if len(fields) > 3 and fields[1] == section)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        out = os.path.join(tmp, 'section.bin')
+        subprocess.run([prefix + 'objcopy', '-O', 'binary', '--only-section=' + section, path, out], check=True)
+        with open(out, 'rb') as data:
+            data = data.read()
+
+    offset = value - address if value >= address else value
+    return data[offset:offset + size]
+
+
+def decode(data):
+    """Returns the header fields and the entries, the byte order is detected from the size field."""
+    for order in '<>':
+        header = struct.unpack_from(order + HEADER.format, data)
+        if header[0] == len(data):
+            break
+    else:
+        sys.exit('os_footprint does not match this tool (size %u)' % len(data))
+
+    count = (len(data) - HEADER.size) // ENTRY.size
+    if count != len(ENTRIES):
+        sys.exit('os_footprint has %u entries, expected %u' % (count, len(ENTRIES)))
+    entries = [struct.unpack_from(order + ENTRY.format, data, HEADER.size + i * ENTRY.size) for i in range(count)]
+    return header, entries
+
+
+def report(header, entries, csv):
+    _, total, budget, levels, mask_bytes = header
+    if csv:
+        print('name,count,entry_size,mask_bytes,bytes')
+        for name, (count, size, masks, total_bytes) in zip(ENTRIES, entries):
+            print('%s,%u,%u,%u,%u' % (name, count, size, masks, total_bytes))
+        print('total,,,,%u' % total)
+        return
+
+    print('%-16s %8s %10s %10s %10s' % ('object', 'count', 'size', 'masks', 'bytes'))
+    for name, (count, size, masks, total_bytes) in zip(ENTRIES, entries):
+        print('%-16s %8u %10s %10s %10u' % (name, count, size or '-', masks or '-', total_bytes))
+    print('%-16s %8s %10s %10s %10u' % ('total', '', '', '', total))
+    print()
+    print('priority levels: %u, task mask: %u bytes (%u bits)' % (levels, mask_bytes, mask_bytes * 8))
+    if budget:
+        print('RAM budget: %u bytes, %u bytes left' % (budget, budget - total))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('object', nargs='?', help='object file or ELF image containing os_footprint')
+    parser.add_argument('--tools-prefix', default='', help='binutils prefix, e.g. arm-none-eabi-')
+    parser.add_argument('--cc', help='compile BeeRTOS_footprint.c with this compiler instead of reading OBJECT')
+    parser.add_argument('--csv', action='store_true', help='print the report as CSV')
+    argv = sys.argv[1:]
+    cflags = argv[argv.index('--') + 1:] if '--' in argv else []
+    args = parser.parse_args(argv[:len(argv) - len(cflags)])
+
+    if args.cc:
+        with tempfile.TemporaryDirectory() as tmp:
+            obj = os.path.join(tmp, 'BeeRTOS_footprint.o')
+            subprocess.run(args.cc.split() + cflags + ['-c', SOURCE, '-o', obj], check=True)
+            data = read_symbol(obj, args.tools_prefix)
+    elif args.object:
+        data = read_symbol(args.object, args.tools_prefix)
+    else:
+        parser.error('OBJECT or --cc is required')
+
+    report(*decode(data), args.csv)
+
+
+if __name__ == '__main__':
+    main()
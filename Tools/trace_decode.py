@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""Convert a RAM dump of the BeeRTOS trace recorder (os_trace_buffer) to a Chrome trace.
+
+The dump can be the buffer itself (e.g. gdb: dump binary value trace.bin os_trace_buffer)
+or any larger memory dump containing it - the buffer is found by its magic number.
+Open the output in https://ui.perfetto.dev or chrome://tracing.
+
+Usage: trace_decode.py trace.bin [-o trace.json] [--hz FREQUENCY] [--offset OFFSET]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_MAGIC = 0x43525442
+TRACE_VERSION = 1
+HEADER = struct.Struct('<IHHIIHHI')
+RECORD = struct.Struct('<IIHBB')
+
+# Keep in sync with os_trace_event_t in BeeRTOS_trace.h
+EVENTS = [
+    None,
+    'TASK_CREATE',
+    'TASK_SWITCHED',
+    'TASK_READY',
+    'TASK_DELAYED',
+    'SEMAPHORE_BLOCKED',
+    'SEMAPHORE_UNBLOCKED',
+    'MESSAGE_BLOCKED',
+    'MESSAGE_UNBLOCKED',
+    'MUTEX_BLOCKED',
+    'MUTEX_UNBLOCKED',
+    'EVENT_BLOCKED',
+    'EVENT_UNBLOCKED',
+    'PRIORITY_INHERITANCE',
+    'PRIORITY_RESTORE',
+    'ISR_ENTER',
+    'ISR_EXIT',
+    'ISR_EXIT_TO_SCHEDULER',
+    'ALARM_START',
+    'ALARM_START_PERIODIC',
+    'ALARM_CANCEL',
+]
+
+PID = 1
+
+
+def find_buffer(data, offset):
+    if offset is not None:
+        return offset
+    magic = struct.pack('<I', TRACE_MAGIC)
+    pos = data.find(magic)
+    while pos >= 0:
+        if pos + HEADER.size <= len(data) and HEADER.unpack_from(data, pos)[1] == TRACE_VERSION:
+            return pos
+        pos = data.find(magic, pos + 1)
+    sys.exit('trace buffer not found in the dump')
+
+
+def read_records(data, base):
+    magic, version, record_size, capacity, hz, task_count, name_length, head = \
+        HEADER.unpack_from(data, base)
+    if magic != TRACE_MAGIC or version != TRACE_VERSION or record_size != RECORD.size:
+        sys.exit('unsupported trace buffer (version %u, record size %u)' % (version, record_size))
+
+    names_offset = base + HEADER.size
+    names = []
+    for i in range(task_count):
+        raw = data[names_offset + i * name_length:names_offset + (i + 1) * name_length]
+        name = raw.split(b'\0', 1)[0].decode('ascii', 'replace')
+        names.append(name if name else 'task %u' % i)
+
+    # Records are aligned to 4 bytes after the name table
+    records_offset = base + ((HEADER.size + task_count * name_length + 3) & ~3)
+    if records_offset + capacity * RECORD.size > len(data):
+        sys.exit('the dump ends inside the trace buffer')
+
+    records = []
+    skipped = 0
+    for index in range(max(0, head - capacity), head):
+        timestamp, arg, obj_id, event, lap = \
+            RECORD.unpack_from(data, records_offset + (index % capacity) * RECORD.size)
+        # Records being written when the RAM was dumped still carry the previous lap
+        if lap != ((index // capacity) + 1) & 0xFF or not 0 < event < len(EVENTS):
+            skipped += 1
+            continue
+        records.append((timestamp, EVENTS[event], obj_id, arg))
+
+    return hz, names, records, skipped
+
+
+def unwrap(records):
+    """Extend the 32-bit timestamps, small negative steps are records reordered by interrupts"""
+    result = []
+    time = 0
+    previous = None
+    for timestamp, event, obj_id, arg in records:
+        if previous is not None:
+            delta = (timestamp - previous) & 0xFFFFFFFF
+            time += delta - (1 << 32) if delta >= (1 << 31) else delta
+        previous = timestamp
+        result.append((time, event, obj_id, arg))
+    result.sort(key=lambda record: record[0])
+    return result
+
+
+def convert(hz, names, records):
+    isr_tid = len(names)
+    alarm_tid = len(names) + 1
+    scale = 1e6 / hz if hz else 1.0
+
+    events = [{'name': 'process_name', 'ph': 'M', 'pid': PID, 'args': {'name': 'BeeRTOS'}}]
+    for tid, name in enumerate(names + ['Interrupts', 'Alarms']):
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': PID, 'tid': tid, 'args': {'name': name}})
+        events.append({'name': 'thread_sort_index', 'ph': 'M', 'pid': PID, 'tid': tid,
+                       'args': {'sort_index': tid}})
+
+    running = None
+    isr_stack = []
+    for time, event, obj_id, arg in records:
+        ts = time * scale
+        if event == 'TASK_SWITCHED':
+            if running is not None:
+                events.append({'name': 'running', 'ph': 'X', 'pid': PID, 'tid': running[0],
+                               'ts': running[1], 'dur': ts - running[1]})
+            running = (obj_id, ts)
+        elif event == 'ISR_ENTER':
+            isr_stack.append(ts)
+        elif event == 'ISR_EXIT':
+            # The oldest records may start inside an interrupt
+            if isr_stack:
+                start = isr_stack.pop()
+                events.append({'name': 'ISR', 'ph': 'X', 'pid': PID, 'tid': isr_tid,
+                               'ts': start, 'dur': ts - start})
+        elif event == 'ISR_EXIT_TO_SCHEDULER':
+            # Context switch requested, from an interrupt or from a task
+            events.append({'name': event, 'ph': 'i', 's': 't', 'pid': PID, 'tid': isr_tid, 'ts': ts})
+        elif event.startswith('ALARM'):
+            events.append({'name': event, 'ph': 'i', 's': 't', 'pid': PID, 'tid': alarm_tid, 'ts': ts,
+                           'args': {'alarm': obj_id, 'period': arg}})
+        else:
+            events.append({'name': event, 'ph': 'i', 's': 't', 'pid': PID, 'tid': obj_id, 'ts': ts,
+                           'args': {'arg': arg}})
+
+    if running is not None and records:
+        end = records[-1][0] * scale
+        events.append({'name': 'running', 'ph': 'X', 'pid': PID, 'tid': running[0],
+                       'ts': running[1], 'dur': end - running[1]})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('dump', help='binary RAM dump containing os_trace_buffer')
+    parser.add_argument('-o', '--output', help='output JSON file (default: stdout)')
+    parser.add_argument('--hz', type=int, help='timestamp frequency, overrides the value in the buffer')
+    parser.add_argument('--offset', type=lambda value: int(value, 0),
+                        help='offset of os_trace_buffer in the dump (default: search for the magic)')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as dump:
+        data = dump.read()
+
+    hz, names, records, skipped = read_records(data, find_buffer(data, args.offset))
+    if args.hz:
+        hz = args.hz
+    if not hz:
+        print('timestamp frequency unknown, 1 timestamp unit is shown as 1 us (use --hz)', file=sys.stderr)
+    if skipped:
+        print('skipped %u incomplete records' % skipped, file=sys.stderr)
+
+    trace = convert(hz, names, unwrap(records))
+
+    if args.output:
+        with open(args.output, 'w') as output:
+            json.dump(trace, output)
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()